@@ -0,0 +1,46 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string_view>
+
+namespace liant::bench {
+
+// prevent the compiler from optimizing away the value (and the computations leading to it)
+template <typename T>
+void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// run 'fn' 'iterations' times and return the average wall time of a single run in nanoseconds
+template <typename TFn>
+double measure(std::size_t iterations, TFn fn) {
+    // warm up caches & allocator
+    for (std::size_t i = 0; i < iterations / 10 + 1; ++i) {
+        fn();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        fn();
+    }
+    const auto finish = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() / static_cast<double>(iterations);
+}
+
+inline void report(std::string_view name, double nanoseconds) {
+    std::printf("%-56.*s %12.1f ns\n", static_cast<int>(name.size()), name.data(), nanoseconds);
+}
+
+// same as 'report' but as a throughput (e.g. objects made per second) given the average time of a single run
+inline void reportPerSecond(std::string_view name, double nanoseconds, std::string_view unit) {
+    std::printf("%-56.*s %12.2f M%.*s/s\n", static_cast<int>(name.size()), name.data(), 1'000.0 / nanoseconds,
+        static_cast<int>(unit.size()), unit.data());
+}
+} // namespace liant::bench
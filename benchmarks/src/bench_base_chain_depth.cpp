@@ -0,0 +1,76 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <memory>
+#include <type_traits>
+
+// cost of a single 'findRaw'/'resolveRaw' of an interface registered within the root of a chain of 1..MaxDepth base
+// containers: every level is a child container having the previous one as its base ('std::shared_ptr<Container<...>>'
+// or 'ContainerSlice<...>'), the interface registered within the leaf container itself is the baseline
+
+namespace {
+constexpr std::size_t MaxDepth = 6;
+constexpr std::size_t Iterations = 5'000'000;
+
+struct Logger {
+    std::size_t value = 42;
+};
+
+template <std::size_t Level>
+struct Plugin {
+    std::size_t value = Level;
+};
+
+struct ContainerKind {};
+struct SliceKind {};
+
+template <typename TKind, std::size_t Depth>
+auto makeChain() {
+    if constexpr (Depth == 0) {
+        return liant::makeContainer(liant::registerInstanceOf<Logger>());
+    } else if constexpr (std::is_same_v<TKind, ContainerKind>) {
+        return liant::makeContainer(makeChain<TKind, Depth - 1>(), liant::registerInstanceOf<Plugin<Depth>>());
+    } else {
+        return liant::makeContainer(
+            liant::ContainerSlice<Logger>(makeChain<TKind, Depth - 1>()), liant::registerInstanceOf<Plugin<Depth>>());
+    }
+}
+
+template <typename TContainer, typename TInterface>
+void measure(const std::shared_ptr<TContainer>& container, const char* what, const char* kind, std::size_t depth) {
+    char name[64];
+
+    const double find = liant::bench::measure(Iterations, [&] { //
+        liant::bench::doNotOptimize(container->template findRaw<TInterface>());
+    });
+    std::snprintf(name, sizeof(name), "findRaw %s, %s depth %zu", what, kind, depth);
+    liant::bench::report(name, find);
+
+    const double resolve = liant::bench::measure(Iterations, [&] { //
+        liant::bench::doNotOptimize(&container->template resolveRaw<TInterface>());
+    });
+    std::snprintf(name, sizeof(name), "resolveRaw %s, %s depth %zu", what, kind, depth);
+    liant::bench::report(name, resolve);
+}
+
+template <typename TKind, std::size_t Depth>
+void run(const char* kind) {
+    auto container = makeChain<TKind, Depth>();
+    container->resolveAll();
+
+    if constexpr (Depth == 1) {
+        measure<typename decltype(container)::element_type, Plugin<Depth>>(container, "local", kind, Depth);
+    }
+    measure<typename decltype(container)::element_type, Logger>(container, "inherited", kind, Depth);
+
+    if constexpr (Depth < MaxDepth) {
+        run<TKind, Depth + 1>(kind);
+    }
+}
+} // namespace
+
+int main() {
+    run<ContainerKind, 1>("Container");
+    run<SliceKind, 1>("ContainerSlice");
+}
@@ -0,0 +1,50 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+
+// hot loop accessing a dependency through the regular (type-erased) view vs. the view caching resolved interfaces
+
+namespace {
+constexpr std::size_t Iterations = 20'000'000;
+
+struct Logger {
+    virtual ~Logger() = default;
+    virtual void log(std::size_t value) = 0;
+};
+LIANT_DEPENDENCY(Logger, logger)
+
+struct CountingLogger : Logger {
+    void log(std::size_t value) override {
+        total += value;
+    }
+    std::size_t total{};
+};
+
+struct Config {
+    std::size_t value = 1;
+};
+LIANT_DEPENDENCY(Config, config)
+
+template <typename TView>
+double run(TView view) {
+    std::size_t i = 0;
+    return liant::bench::measure(Iterations, [&] {
+        // the view is a member of some component in real life: don't let the compiler hoist the lookups out of the loop
+        liant::bench::doNotOptimize(view);
+        view.loggerRaw().log(view.configRaw().value + i++);
+    });
+}
+} // namespace
+
+int main() {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<CountingLogger>().as<Logger>(),
+        liant::registerInstanceOf<Config>()
+    );
+    // clang-format on
+
+    liant::bench::report("ContainerView<Logger, Config>", run(liant::ContainerView<Logger, Config>(container)));
+    liant::bench::report("ContainerViewCached<Logger, Config>", run(liant::ContainerViewCached<Logger, Config>(container)));
+    liant::bench::doNotOptimize(static_cast<CountingLogger*>(container->findRaw<Logger>())->total);
+}
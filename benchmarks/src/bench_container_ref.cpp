@@ -0,0 +1,41 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+
+// virtual interface calls through the type-erased view vs. the concrete ref (statically resolved, devirtualized)
+
+namespace {
+constexpr std::size_t Iterations = 20'000'000;
+
+struct Logger {
+    virtual ~Logger() = default;
+    virtual void log(std::size_t value) = 0;
+};
+
+// 'final' lets the compiler devirtualize (and inline) the calls made through 'CountingLogger&'
+struct CountingLogger final : Logger {
+    void log(std::size_t value) override {
+        total += value;
+    }
+    std::size_t total{};
+};
+
+template <typename TAccessor>
+double run(TAccessor accessor) {
+    std::size_t i = 0;
+    return liant::bench::measure(Iterations, [&] {
+        // the view/ref is a member of some component in real life: don't let the compiler hoist the lookups out of the loop
+        liant::bench::doNotOptimize(accessor);
+        accessor.template resolveRaw<Logger>().log(i++);
+    });
+}
+} // namespace
+
+int main() {
+    auto container = liant::makeContainer(liant::registerInstanceOf<CountingLogger>().as<Logger>());
+    using TContainer = decltype(container)::element_type;
+
+    liant::bench::report("ContainerView<Logger>", run(liant::ContainerView<Logger>(container)));
+    liant::bench::report("ContainerRef<TContainer, Logger>", run(liant::ContainerRef<TContainer, Logger>(container)));
+    liant::bench::doNotOptimize(container->resolveConcrete<Logger>().total);
+}
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// batch of worker objects: one-by-one 'makeUnique' vs. contiguous 'makeN' vs. 'makeInto' a monotonic arena
+
+namespace {
+constexpr std::size_t Iterations = 2'000;
+constexpr std::size_t BatchSize = 4'096;
+
+struct Config {
+    std::size_t value = 1;
+};
+
+struct Worker {
+    liant::ContainerView<Config> di;
+    std::size_t processed{};
+
+    void process() {
+        processed += di.findRaw<Config>()->value;
+    }
+};
+} // namespace
+
+int main() {
+    auto container = liant::makeContainer(liant::registerInstanceOf<Config>());
+    liant::FactoryView<Worker> factory = liant::ContainerView<Config>(container).makeFactoryView<Worker>();
+
+    const double uniqueNs = liant::bench::measure(Iterations, [&] {
+        std::vector<std::unique_ptr<Worker>> workers;
+        workers.reserve(BatchSize);
+        for (std::size_t i = 0; i < BatchSize; ++i) {
+            workers.push_back(factory.makeUnique());
+        }
+        for (auto& worker : workers) {
+            worker->process();
+        }
+        liant::bench::doNotOptimize(workers);
+    });
+
+    const double makeNNs = liant::bench::measure(Iterations, [&] {
+        std::vector<Worker> workers = factory.makeN(BatchSize);
+        for (auto& worker : workers) {
+            worker.process();
+        }
+        liant::bench::doNotOptimize(workers);
+    });
+
+    std::pmr::monotonic_buffer_resource arena(BatchSize * sizeof(Worker) * 2);
+    const double makeIntoNs = liant::bench::measure(Iterations, [&] {
+        for (std::size_t i = 0; i < BatchSize; ++i) {
+            Worker* worker = factory.makeInto(arena);
+            worker->process();
+            liant::bench::doNotOptimize(worker);
+        }
+        // 'Worker' has nothing to destroy: free the whole batch at once
+        arena.release();
+    });
+
+    liant::bench::reportPerSecond("batch of 4096 x makeUnique", uniqueNs / BatchSize, "objects");
+    liant::bench::reportPerSecond("makeN(4096)", makeNNs / BatchSize, "objects");
+    liant::bench::reportPerSecond("batch of 4096 x makeInto(monotonic arena)", makeIntoNs / BatchSize, "objects");
+}
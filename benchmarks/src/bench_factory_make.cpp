@@ -0,0 +1,72 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// short-lived objects made through 'Factory<U>'/'FactoryView<U>' in a hot loop
+
+namespace {
+constexpr std::size_t Iterations = 5'000'000;
+
+template <auto IdV>
+struct Service {
+    std::size_t value = IdV;
+};
+
+using Service1 = Service<1>;
+using Service2 = Service<2>;
+using Service3 = Service<3>;
+using Service4 = Service<4>;
+
+struct Request {
+    liant::ContainerView<Service1, Service2, Service3, Service4> di;
+};
+
+template <typename TFactory>
+void run(std::string_view name, const TFactory& factory) {
+    std::size_t total = 0;
+
+    const double makeNs = liant::bench::measure(Iterations, [&] {
+        Request request = factory.make();
+        liant::bench::doNotOptimize(request);
+        total += request.di.template findRaw<Service1>()->value;
+    });
+    const double makeUniqueNs = liant::bench::measure(Iterations, [&] {
+        std::unique_ptr<Request> request = factory.makeUnique();
+        liant::bench::doNotOptimize(request);
+        total += request->di.template findRaw<Service2>()->value;
+    });
+    const double makeSharedNs = liant::bench::measure(Iterations, [&] {
+        std::shared_ptr<Request> request = factory.makeShared();
+        liant::bench::doNotOptimize(request);
+        total += request->di.template findRaw<Service3>()->value;
+    });
+    const double makePooledNs = liant::bench::measure(Iterations, [&] {
+        liant::Pooled<Request> request = factory.makePooled();
+        liant::bench::doNotOptimize(request);
+        total += request->di.template findRaw<Service4>()->value;
+    });
+    liant::bench::doNotOptimize(total);
+
+    liant::bench::reportPerSecond(std::string(name) + "::make", makeNs, "objects");
+    liant::bench::reportPerSecond(std::string(name) + "::makeUnique", makeUniqueNs, "objects");
+    liant::bench::reportPerSecond(std::string(name) + "::makeShared", makeSharedNs, "objects");
+    liant::bench::reportPerSecond(std::string(name) + "::makePooled", makePooledNs, "objects");
+}
+} // namespace
+
+int main() {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Service1>(),
+        liant::registerInstanceOf<Service2>(),
+        liant::registerInstanceOf<Service3>(),
+        liant::registerInstanceOf<Service4>()
+    );
+    // clang-format on
+    liant::ContainerView<Service1, Service2, Service3, Service4> view(container);
+
+    run("Factory<Request>", view.makeFactory<Request>());
+    run("FactoryView<Request>", view.makeFactoryView<Request>());
+}
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// startup (makeContainer + resolveAll) & teardown cost of a container with 'ItemsCount' items
+// each item either allocated separately (default) or stored inside the container ('inPlace')
+
+namespace {
+constexpr std::size_t ItemsCount = 128;
+constexpr std::size_t ContainersCount = 256;
+constexpr std::size_t Rounds = 20;
+
+template <std::size_t I>
+struct Component {
+    std::array<std::uint64_t, 4> payload{ I, I, I, I };
+};
+
+template <std::size_t... Is>
+auto makeHeapContainer(std::index_sequence<Is...>) {
+    return liant::makeContainer(liant::registerInstanceOf<Component<Is>>()...);
+}
+
+template <std::size_t... Is>
+auto makeInPlaceContainer(std::index_sequence<Is...>) {
+    return liant::makeContainer(liant::registerInstanceOf<Component<Is>>().inPlace()...);
+}
+
+template <typename TMakeContainer>
+void run(const char* name, TMakeContainer makeContainer) {
+    using ContainerPtr = decltype(makeContainer());
+
+    double startup = 0.0;
+    double teardown = 0.0;
+
+    for (std::size_t round = 0; round < Rounds; ++round) {
+        std::vector<ContainerPtr> containers;
+        containers.reserve(ContainersCount);
+
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < ContainersCount; ++i) {
+            containers.push_back(makeContainer());
+            containers.back()->resolveAll();
+        }
+        const auto resolved = std::chrono::steady_clock::now();
+        containers.clear();
+        const auto destroyed = std::chrono::steady_clock::now();
+
+        startup += std::chrono::duration<double, std::nano>(resolved - start).count();
+        teardown += std::chrono::duration<double, std::nano>(destroyed - resolved).count();
+    }
+
+    const double perContainer = static_cast<double>(Rounds * ContainersCount);
+    std::printf("%s (%zu items per container)\n", name, ItemsCount);
+    liant::bench::report("  startup  (makeContainer + resolveAll)", startup / perContainer);
+    liant::bench::report("  teardown (~Container)", teardown / perContainer);
+}
+} // namespace
+
+int main() {
+    run("per-item new/delete", [] { return makeHeapContainer(std::make_index_sequence<ItemsCount>{}); });
+    run("inPlace", [] { return makeInPlaceContainer(std::make_index_sequence<ItemsCount>{}); });
+}
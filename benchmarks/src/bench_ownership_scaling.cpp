@@ -0,0 +1,66 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 'SharedRef' taken (and dropped) by every call on many threads at once: the references to the 'Container' are
+// counted by a single atomic counter ('Atomic') vs. per-thread-slot counters ('Sharded')
+
+namespace {
+constexpr std::size_t IterationsPerThread = 2'000'000;
+
+struct Logger {
+    std::size_t level = 1;
+};
+
+// average wall time of a single 'resolve' + 'SharedRef' copy across all the threads
+template <typename TContainer>
+double run(const TContainer& container, std::size_t threadsCount) {
+    std::latch started(static_cast<std::ptrdiff_t>(threadsCount) + 1);
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&] {
+            started.arrive_and_wait();
+            for (std::size_t j = 0; j < IterationsPerThread; ++j) {
+                liant::SharedRef<Logger> logger = container->template resolve<Logger>();
+                liant::SharedRef<Logger> copy = logger;
+                liant::bench::doNotOptimize(copy);
+                liant::bench::doNotOptimize(copy->level);
+            }
+        });
+    }
+
+    started.arrive_and_wait();
+    const auto start = std::chrono::steady_clock::now();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto finish = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(finish - start).count() /
+           static_cast<double>(IterationsPerThread * threadsCount);
+}
+} // namespace
+
+int main() {
+    auto atomic = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto sharded = liant::makeContainer(liant::OwnershipPolicy::Sharded, liant::registerInstanceOf<Logger>());
+    auto nonAtomic = liant::makeContainer(liant::OwnershipPolicy::NonAtomic, liant::registerInstanceOf<Logger>());
+
+    const std::size_t maxThreads = std::max<std::size_t>(std::thread::hardware_concurrency(), 4);
+
+    // 'NonAtomic' is for the single-threaded containers only
+    liant::bench::reportPerSecond("NonAtomic (1 thread)", run(nonAtomic, 1), "refs");
+
+    for (std::size_t threadsCount = 1; threadsCount <= maxThreads; threadsCount *= 2) {
+        const std::string threads = " (" + std::to_string(threadsCount) + (threadsCount == 1 ? " thread)" : " threads)");
+        liant::bench::reportPerSecond("Atomic" + threads, run(atomic, threadsCount), "refs");
+        liant::bench::reportPerSecond("Sharded" + threads, run(sharded, threadsCount), "refs");
+    }
+}
@@ -0,0 +1,64 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+// a child container per incoming request: 'RequestContext' and 'Handler' are created within the child container, the
+// 'Handler' gets the application-wide 'Logger'/'Config' from the parent one, then the child container is destroyed
+// 'makeContainer' with 'ContainerSlice' parent vs 'makeScopedContainer' within an arena over a reused stack buffer
+
+namespace {
+constexpr std::size_t Iterations = 2'000'000;
+
+struct Logger {
+    std::size_t value = 1;
+};
+
+struct Config {
+    std::size_t value = 2;
+};
+
+struct RequestContext {
+    std::size_t id = 0;
+};
+
+struct Handler {
+    Handler(liant::ContainerView<Logger, Config, RequestContext> di)
+        : di(di) {}
+
+    std::size_t handle() {
+        return di.resolveRaw<Logger>().value + di.resolveRaw<Config>().value + di.resolveRaw<RequestContext>().id;
+    }
+
+    liant::ContainerView<Logger, Config, RequestContext> di;
+};
+} // namespace
+
+int main() {
+    auto app = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    app->resolveAll();
+    liant::ContainerSlice<Logger, Config> appSlice(app);
+    liant::ContainerView<Logger, Config> appView(app);
+
+    std::size_t requestId = 0;
+    const double heap = liant::bench::measure(Iterations, [&] {
+        auto request = liant::makeContainer(appSlice, liant::registerInstanceOf<RequestContext>(), liant::registerInstanceOf<Handler>());
+        request->resolveRaw<RequestContext>().id = ++requestId;
+        liant::bench::doNotOptimize(request->resolveRaw<Handler>().handle());
+    });
+    liant::bench::reportPerSecond("makeContainer per request", heap, "requests");
+
+    alignas(std::max_align_t) std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+    const double scoped = liant::bench::measure(Iterations, [&] {
+        {
+            auto request = liant::makeScopedContainer(arena, appView, //
+                liant::registerInstanceOf<RequestContext>(), liant::registerInstanceOf<Handler>());
+            request->resolveRaw<RequestContext>().id = ++requestId;
+            liant::bench::doNotOptimize(request->resolveRaw<Handler>().handle());
+        }
+        arena.release();
+    });
+    liant::bench::reportPerSecond("makeScopedContainer per request", scoped, "requests");
+}
@@ -0,0 +1,68 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+// cost of a single 'findRaw'/'resolveRaw' through a view which is the result of 'Depth' subset conversions
+// (ContainerView<I0..I16> -> ContainerView<I0..I15> -> ... -> ContainerView<I0..I(16-Depth)>)
+
+namespace {
+constexpr std::size_t MaxDepth = 16;
+constexpr std::size_t Iterations = 5'000'000;
+
+template <std::size_t I>
+struct Component {
+    std::size_t value = I;
+};
+
+template <std::size_t... Is>
+auto viewOf(std::index_sequence<Is...>) -> liant::ContainerView<Component<Is>...>;
+
+template <std::size_t N>
+using ViewOf = decltype(viewOf(std::make_index_sequence<N>{}));
+
+template <std::size_t... Is>
+auto makeContainer(std::index_sequence<Is...>) {
+    return liant::makeContainer(liant::registerInstanceOf<Component<Is>>()...);
+}
+
+template <std::size_t Depth>
+ViewOf<MaxDepth + 1 - Depth> convert(const ViewOf<MaxDepth + 1>& root) {
+    if constexpr (Depth == 0) {
+        return root;
+    } else {
+        return ViewOf<MaxDepth + 1 - Depth>(convert<Depth - 1>(root));
+    }
+}
+
+template <std::size_t Depth>
+void run(const ViewOf<MaxDepth + 1>& root) {
+    auto view = convert<Depth>(root);
+    char name[64];
+
+    const double find = liant::bench::measure(Iterations, [&] { //
+        liant::bench::doNotOptimize(view.template findRaw<Component<0>>());
+    });
+    std::snprintf(name, sizeof(name), "findRaw, conversions depth %zu", Depth);
+    liant::bench::report(name, find);
+
+    const double resolve = liant::bench::measure(Iterations, [&] { //
+        liant::bench::doNotOptimize(&view.template resolveRaw<Component<0>>());
+    });
+    std::snprintf(name, sizeof(name), "resolveRaw, conversions depth %zu", Depth);
+    liant::bench::report(name, resolve);
+}
+
+template <std::size_t... Depths>
+void runAll(const ViewOf<MaxDepth + 1>& root, std::index_sequence<Depths...>) {
+    (run<Depths + 1>(root), ...);
+}
+} // namespace
+
+int main() {
+    auto container = makeContainer(std::make_index_sequence<MaxDepth + 1>{});
+    ViewOf<MaxDepth + 1> root(container);
+
+    runAll(root, std::make_index_sequence<MaxDepth>{});
+}
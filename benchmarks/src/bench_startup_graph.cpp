@@ -0,0 +1,77 @@
+#include "bench.hpp"
+#include "liant/liant.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <utility>
+
+// startup of a 10k-node dependencies graph: 'ContainersCount' containers of 'NodesPerContainer' nodes each created
+// with 'resolveAll', every node (but the root) gets its dependencies injected through a view/slice of 'TSlice' kind
+
+namespace {
+constexpr std::size_t NodesPerContainer = 100;
+constexpr std::size_t ContainersCount = 100;
+constexpr std::size_t Iterations = 20;
+
+template <std::size_t N, template <typename...> typename TSlice>
+struct Node;
+
+// node 'N' depends on the nodes 'N - 1' and 'N / 2'
+template <std::size_t N, template <typename...> typename TSlice>
+struct DependenciesOf {
+    using type = TSlice<Node<N - 1, TSlice>, Node<N / 2, TSlice>>;
+};
+
+template <template <typename...> typename TSlice>
+struct DependenciesOf<1, TSlice> {
+    using type = TSlice<Node<0, TSlice>>;
+};
+
+template <template <typename...> typename TSlice>
+struct DependenciesOf<2, TSlice> {
+    using type = TSlice<Node<1, TSlice>>;
+};
+
+template <std::size_t N, template <typename...> typename TSlice>
+struct Node {
+    // note: the owning slice isn't kept by the node (that would keep the 'Container' alive forever)
+    Node(typename DependenciesOf<N, TSlice>::type di) {
+        liant::bench::doNotOptimize(di);
+    }
+
+    std::size_t value = N;
+};
+
+template <template <typename...> typename TSlice>
+struct Node<0, TSlice> {
+    std::size_t value = 0;
+};
+
+template <template <typename...> typename TSlice, std::size_t... Is>
+void buildGraph(std::index_sequence<Is...>) {
+    for (std::size_t i = 0; i < ContainersCount; ++i) {
+        auto container = liant::makeContainer(liant::registerInstanceOf<Node<Is, TSlice>>()...);
+        container->resolveAll();
+        liant::bench::doNotOptimize(container->template findRaw<Node<NodesPerContainer - 1, TSlice>>()->value);
+    }
+}
+
+template <template <typename...> typename TSlice>
+void run(const char* kind) {
+    const double graph = liant::bench::measure(Iterations, [] { //
+        buildGraph<TSlice>(std::make_index_sequence<NodesPerContainer>{});
+    });
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "10k-node graph, %s", kind);
+    liant::bench::report(name, graph);
+    std::snprintf(name, sizeof(name), "per node, %s", kind);
+    liant::bench::report(name, graph / static_cast<double>(NodesPerContainer * ContainersCount));
+}
+} // namespace
+
+int main() {
+    run<liant::ContainerView>("ContainerView");
+    run<liant::ContainerViewCached>("ContainerViewCached");
+    run<liant::ContainerSlice>("ContainerSlice");
+    run<liant::ContainerSliceWeak>("ContainerSliceWeak");
+}
@@ -31,7 +31,7 @@ int main() {
 
     liant::SharedPtr type2Inst = container->find<example::Type2>();
 
-    type2Inst->di.prettyCustomGetType1();
+    type2Inst->di.prettyCustomGetType1Raw();
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+#include "liant/details/type_name.hpp"
+#include "liant/export_macro.hpp"
+#include "liant/ownership.hpp"
+#include "liant/ptr.hpp"
+
+#ifndef LIANT_MODULE
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+namespace details {
+template <typename UTraits, typename USelf>
+class ContainerSliceImpl;
+} // namespace details
+
+// called by the lifetime checker of 'Borrowed' (see 'LIANT_CHECK_BORROWS') once the 'Dependency' is borrowed from the
+// 'Container' which is already destroyed, 'typeName' is the name of the borrowed 'Dependency' type
+// default handler prints the error and aborts
+using DanglingBorrowHandler = void (*)(std::string_view typeName);
+
+namespace details {
+inline void abortOnDanglingBorrow(std::string_view typeName) {
+    std::cerr << "liant: '" << typeName << "' is borrowed from the destroyed Container" << std::endl;
+    std::abort();
+}
+
+inline DanglingBorrowHandler& danglingBorrowHandler() {
+    static constinit DanglingBorrowHandler handler = &abortOnDanglingBorrow;
+    return handler;
+}
+} // namespace details
+
+// returns the previous handler
+inline DanglingBorrowHandler setDanglingBorrowHandler(DanglingBorrowHandler handler) {
+    DanglingBorrowHandler previous = details::danglingBorrowHandler();
+    details::danglingBorrowHandler() = handler;
+    return previous;
+}
+
+// 'Dependency' borrowed from the 'Container' for the duration of the full-expression only (e.g. 'di.logger()->logInfo(...)')
+// unlike 'SharedRef' it doesn't touch the reference count of the 'Container' at all so it is cheap enough for hot paths
+// - it is neither copyable nor movable and it can only be dereferenced while being a temporary: 'di.logger()->...'
+//   compiles while 'auto&& logger = di.logger(); logger->...' doesn't
+//   this only catches the accidental misuse: 'std::move(logger)->...' still compiles on the named 'Borrowed'
+// - convert it into 'SharedRef' if you do need to keep the 'Dependency' for longer: 'SharedRef logger = di.logger()'
+//
+// define 'LIANT_CHECK_BORROWS' (for the whole program) to enable the lifetime checker: 'Borrowed' holds a weak
+// reference to the 'Container' then and every access (and the end of the full-expression) checks the 'Container' is
+// still alive, see 'liant::setDanglingBorrowHandler' (the borrows from the scoped 'Container' are not checked)
+template <typename T>
+class [[nodiscard]] Borrowed {
+    template <typename UTraits, typename USelf>
+    friend class details::ContainerSliceImpl;
+
+    Borrowed(T& ref, const ContainerBase& container)
+        : ptr(std::addressof(ref))
+#ifdef LIANT_CHECK_BORROWS
+        , owner(details::ContainerWeakOwner::of(container))
+#endif
+        , container(&container) {
+    }
+
+public:
+    Borrowed(const Borrowed&) = delete;
+    Borrowed& operator=(const Borrowed&) = delete;
+
+#ifdef LIANT_CHECK_BORROWS
+    ~Borrowed() {
+        check();
+    }
+#endif
+
+    T* get() && {
+        check();
+        return ptr;
+    }
+    T* get() & = delete;
+
+    T* operator->() && {
+        check();
+        return ptr;
+    }
+    T* operator->() & = delete;
+
+    T& operator*() && {
+        check();
+        return *ptr;
+    }
+    T& operator*() & = delete;
+
+    operator SharedRef<T>() && {
+        check();
+        return SharedRef<T>(*ptr, details::ContainerOwner::of(*container));
+    }
+
+private:
+    void check() const {
+#ifdef LIANT_CHECK_BORROWS
+        // the uncounted 'Container' (see 'makeScopedContainer') can't be checked
+        if (owner && owner.expired()) {
+            details::danglingBorrowHandler()(details::typeName<T>());
+        }
+#endif
+    }
+
+private:
+    T* ptr{};
+#ifdef LIANT_CHECK_BORROWS
+    details::ContainerWeakOwner owner{};
+#endif
+    const ContainerBase* container{};
+};
+} // namespace liant
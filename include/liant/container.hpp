@@ -1,22 +1,73 @@
 #pragma once
+#include "liant/details/type_name.hpp"
+#include "liant/executor.hpp"
 #include "liant/export_macro.hpp"
+#include "liant/frozen_container.hpp"
+#include "liant/ownership.hpp"
 #include "liant/ptr.hpp"
+#include "liant/shared_bundle.hpp"
+#include "liant/task.hpp"
 #include "liant/tuple.hpp"
 #include "liant/typelist.hpp"
 
 #ifndef LIANT_MODULE
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <concepts>
+#include <cstddef>
+#include <exception>
 #include <functional>
 #include <memory>
+#include <new>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #endif
 
 namespace liant::details {
 template <typename UTraits, typename USelf>
 class ContainerSliceImpl;
-}
+
+template <typename TInterface>
+struct VTableItem;
+
+// the interface coming through the base slice: the (erased) 'Container<...>' registering it and its table item
+// (see 'Container::linkInherited')
+template <typename TInterface>
+struct VTableLink {
+    ContainerBase* container{};
+    const VTableItem<TInterface>* item{};
+};
+
+// link to the inherited interface (see 'Container::linkInherited')
+struct InheritedLink {
+    // 'Container<...>' registering the inherited interface
+    void* container{};
+    // 'VTableItem<TInterface>' of the interface coming through the base slice, nullptr otherwise
+    const void* item{};
+};
+
+// see 'container_slice_vtable.hpp'
+template <typename TContainer, typename TInterface>
+const VTableItem<TInterface>* vtableItemOf();
+
+template <typename TContainer, typename TInterface>
+VTableLink<TInterface> vtableLinkOf(ContainerBase* container);
+
+// base container of the scoped 'Container' (see 'makeScopedContainer')
+template <typename TBaseContainer>
+class ScopedBase;
+
+template <typename TBaseContainer>
+static constexpr bool IsScopedBase = false;
+
+template <typename TBaseContainer>
+static constexpr bool IsScopedBase<ScopedBase<TBaseContainer>> = true;
+} // namespace liant::details
 
 // clang-format off
 LIANT_EXPORT
@@ -25,11 +76,20 @@ namespace liant {
 
 enum class ItemLifetime { External, DI };
 
-template <ItemLifetime LifetimeV, typename T, typename TInterfacesTypeList, typename TCtorArgsTypeList>
+// where DI-owned instance lives:
+// - Heap: separate 'new'/'delete' per item (default)
+// - InPlace: aligned raw storage inside the 'Container' object itself (placement-new, no per-item allocation)
+enum class ItemStorage { Heap, InPlace };
+
+template <ItemLifetime LifetimeV,
+    typename T,
+    typename TInterfacesTypeList,
+    typename TCtorArgsTypeList,
+    ItemStorage StorageV = ItemStorage::Heap>
 struct TypeMapping;
 
-template <ItemLifetime LifetimeV, typename T, typename... TInterfaces, typename... TCtorArgs>
-struct TypeMapping<LifetimeV, T, TypeList<TInterfaces...>, TypeList<TCtorArgs...>> {
+template <ItemLifetime LifetimeV, typename T, typename... TInterfaces, typename... TCtorArgs, ItemStorage StorageV>
+struct TypeMapping<LifetimeV, T, TypeList<TInterfaces...>, TypeList<TCtorArgs...>, StorageV> {
     static_assert((std::is_base_of_v<TInterfaces, T> && ...), "Type T must be derived from each of the TInterfaces");
 
     using Type = T;
@@ -37,6 +97,7 @@ struct TypeMapping<LifetimeV, T, TypeList<TInterfaces...>, TypeList<TCtorArgs...
     using CtorArgs = TypeList<TCtorArgs...>;
     using CtorArgsTuple = std::tuple<TCtorArgs...>;
     static constexpr ItemLifetime Lifetime = LifetimeV;
+    static constexpr ItemStorage Storage = StorageV;
 
     // snake_case aliases
     using type = Type;
@@ -44,8 +105,146 @@ struct TypeMapping<LifetimeV, T, TypeList<TInterfaces...>, TypeList<TCtorArgs...
     using ctor_args_type = CtorArgs;
     using ctor_args_tuple_type = CtorArgsTuple;
     static constexpr ItemLifetime lifetime_value = Lifetime;
+    static constexpr ItemStorage storage_value = Storage;
+};
+} // namespace liant
+
+namespace liant::details {
+// raw storage for 'ItemStorage::InPlace' items (empty for 'ItemStorage::Heap' ones)
+template <typename T, ItemStorage StorageV>
+struct ItemBuffer {};
+
+template <typename T>
+struct ItemBuffer<T, ItemStorage::InPlace> {
+    ItemBuffer() = default;
+    // never copy the bytes: 'RegisteredItem' is only copied before its instance is created
+    ItemBuffer(const ItemBuffer&) {}
+    ItemBuffer& operator=(const ItemBuffer&) {
+        return *this;
+    }
+
+    alignas(T) std::byte bytes[sizeof(T)];
+};
+
+// common cache line size (std::hardware_destructive_interference_size is not ABI-stable hence not used here)
+inline constexpr std::size_t CacheLineSize = 64;
+
+// guarantees DI item is created exactly once even if it is requested from multiple threads at the same time
+class ItemOnce {
+    enum class State : unsigned char { Empty, Creating, Created };
+
+public:
+    ItemOnce() = default;
+    // 'RegisteredItem' is only copied before its instance is created
+    ItemOnce(const ItemOnce&) {}
+    ItemOnce& operator=(const ItemOnce&) {
+        return *this;
+    }
+
+    // the item is ready to be used (pairs with 'commit' so the item itself is visible to the calling thread)
+    bool isCreated() const {
+        return state.load(std::memory_order_acquire) == State::Created;
+    }
+
+    // 'true' - the calling thread should create the item and then 'commit' (or 'rollback' on failure)
+    // 'false' - the item is already created (if other thread was creating it then wait for it to finish)
+    bool begin() {
+        // fast path: every request but the first one ends up here
+        if (isCreated()) {
+            return false;
+        }
+
+        State expected = State::Empty;
+        while (!state.compare_exchange_weak(expected, State::Creating, std::memory_order_acquire)) {
+            if (expected == State::Created) {
+                return false;
+            }
+            if (expected == State::Creating) {
+                state.wait(State::Creating, std::memory_order_acquire);
+            }
+            expected = State::Empty;
+        }
+        return true;
+    }
+
+    void commit() {
+        state.store(State::Created, std::memory_order_release);
+        state.notify_all();
+    }
+
+    void rollback() {
+        state.store(State::Empty, std::memory_order_release);
+        state.notify_all();
+    }
+
+private:
+    std::atomic<State> state{ State::Empty };
 };
 
+// the state of the DI item touched by every lookup: the instance itself and whether it is created already
+// kept apart from 'RegisteredItem' (see 'Container::slots') so that creating/reading one item doesn't invalidate the
+// cache line of another item: the hot part never straddles the cache lines (it is aligned to its own size) and the slots
+// are a cache line apart, still the 'Container' itself stays at the natural alignment
+struct alignas(2 * sizeof(void*)) ItemSlot {
+    void* instance{};
+    ItemOnce once;
+    std::byte padding[CacheLineSize - 2 * sizeof(void*)];
+};
+static_assert(sizeof(ItemSlot) == CacheLineSize);
+
+// dependencies of the item which is being created by the current thread right now
+// used to split items into teardown waves (see 'Container::destroyAllParallel')
+class CreationFrame {
+public:
+    explicit CreationFrame(const void* container)
+        : container(container)
+        , prev(std::exchange(current(), this)) {}
+    ~CreationFrame() {
+        current() = prev;
+    }
+    CreationFrame(const CreationFrame&) = delete;
+    CreationFrame& operator=(const CreationFrame&) = delete;
+
+    // item of the 'container' with the 'dependencyLevel' has been resolved while creating current item
+    static void dependsOn(const void* container, std::size_t dependencyLevel) {
+        if (CreationFrame* frame = current(); frame && frame->container == container) {
+            frame->level = std::max(frame->level, dependencyLevel + 1);
+        }
+    }
+
+    // current item got lazy view/slice so its dependencies are unknown
+    static void dependsOnUnknown(const void* container) {
+        if (CreationFrame* frame = current(); frame && frame->container == container) {
+            frame->unknownDependencies = true;
+        }
+    }
+
+    std::size_t getLevel() const {
+        return level;
+    }
+
+    bool hasUnknownDependencies() const {
+        return unknownDependencies;
+    }
+
+private:
+    static CreationFrame*& current() {
+        static thread_local CreationFrame* frame{};
+        return frame;
+    }
+
+private:
+    const void* container{};
+    CreationFrame* prev{};
+    std::size_t level{};
+    bool unknownDependencies{};
+};
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
 
 template <typename TTypeMapping>
 class RegisteredItem {
@@ -68,10 +267,11 @@ public:
     template <typename... TInterfaces>
     auto as() && {
         constexpr ItemLifetime Lifetime = TTypeMapping::Lifetime;
+        constexpr ItemStorage Storage = TTypeMapping::Storage;
         using Type = TTypeMapping::Type;
         using Interfaces = TypeList<TInterfaces...>;
         using CtorArgs = TTypeMapping::CtorArgs;
-        using NextTypeMapping = TypeMapping<Lifetime, Type, Interfaces, CtorArgs>;
+        using NextTypeMapping = TypeMapping<Lifetime, Type, Interfaces, CtorArgs, Storage>;
 
         return RegisteredItem<NextTypeMapping>{ item, std::move(ctorArgs) };
     }
@@ -79,55 +279,153 @@ public:
     template <typename... TCtorArgs>
     auto bindArgs(TCtorArgs&&... ctorArgs) && {
         constexpr ItemLifetime Lifetime = TTypeMapping::Lifetime;
+        constexpr ItemStorage Storage = TTypeMapping::Storage;
         using Type = TTypeMapping::Type;
         using Interfaces = TTypeMapping::Interfaces;
         using CtorArgs = TypeList<std::decay_t<TCtorArgs>...>;
-        using NextTypeMapping = TypeMapping<Lifetime, Type, Interfaces, CtorArgs>;
+        using NextTypeMapping = TypeMapping<Lifetime, Type, Interfaces, CtorArgs, Storage>;
 
         return RegisteredItem<NextTypeMapping>{ item, std::forward<TCtorArgs>(ctorArgs)... };
     }
 
+    // store the instance inside the 'Container' object itself instead of allocating it separately
+    // all 'inPlace' items of the container share single allocation (the one of the container) and are laid out next to each other
+    auto inPlace() && {
+        static_assert(liant::PrintConditional<TTypeMapping::Lifetime == ItemLifetime::DI, typename TTypeMapping::Type>,
+            "Only instances created by DI container may be stored in-place "
+            "(search 'liant::Print' in the compilation output for details)");
+
+        constexpr ItemLifetime Lifetime = TTypeMapping::Lifetime;
+        using Type = TTypeMapping::Type;
+        using Interfaces = TTypeMapping::Interfaces;
+        using CtorArgs = TTypeMapping::CtorArgs;
+        using NextTypeMapping = TypeMapping<Lifetime, Type, Interfaces, CtorArgs, ItemStorage::InPlace>;
+
+        return RegisteredItem<NextTypeMapping>{ item, std::move(ctorArgs) };
+    }
+
 private:
     template <typename TBaseContainer, typename... TTypeMappings>
     friend class Container;
 
+    // External item
     template <typename TInterface>
-    auto get() const {
+    TInterface* get() const {
         return static_cast<TInterface*>(item);
     }
 
+    // DI item may be being created by other thread right now, it is only safe to use it once 'once' says so
+    template <typename TInterface>
+    TInterface* get(const details::ItemSlot& slot) const {
+        if (!slot.once.isCreated()) {
+            return nullptr;
+        }
+        return getCreated<TInterface>(slot);
+    }
+
+    // the caller has already synchronized with the item creation (see 'ItemOnce::begin')
+    template <typename TInterface>
+    TInterface* getCreated(const details::ItemSlot& slot) const {
+        return static_cast<TInterface*>(static_cast<TTypeMapping::Type*>(slot.instance));
+    }
+
     template <typename TInterface, typename TContainerSliceCtorHook, typename... TArgs>
-    auto& instantiate(TContainerSliceCtorHook& hook, TArgs&&... args) {
-        item = new TTypeMapping::Type{ hook, std::forward<TArgs>(args)... };
+    auto& instantiate(details::ItemSlot& slot, TContainerSliceCtorHook& hook, TArgs&&... args) {
+        auto* instance = construct(hook, std::forward<TArgs>(args)...);
+        slot.instance = instance;
+        postCreate(slot, *instance);
 
-        if constexpr (requires { item->postCreate(); }) {
-            item->postCreate();
+        return static_cast<TInterface&>(*instance);
+    }
+
+    template <typename TInterface, typename... TArgs>
+    auto& instantiateTrivial(details::ItemSlot& slot, TArgs&&... args) {
+        auto* instance = construct(std::forward<TArgs>(args)...);
+        slot.instance = instance;
+        postCreate(slot, *instance);
+
+        return static_cast<TInterface&>(*instance);
+    }
+
+    // the instance is destroyed if 'postCreate' throws: the item may be resolved again then
+    void postCreate(details::ItemSlot& slot, TTypeMapping::Type& instance) {
+        if constexpr (requires { instance.postCreate(); }) {
+            try {
+                instance.postCreate();
+            } catch (...) {
+                release(slot);
+                throw;
+            }
         }
+    }
 
-        return static_cast<TInterface&>(*item);
+    void destroy(details::ItemSlot& slot) {
+        using Type = TTypeMapping::Type;
+        Type* instance = static_cast<Type*>(slot.instance);
+
+        if constexpr (requires { instance->preDestroy(); }) {
+            // the instance is destroyed even if 'preDestroy' throws, the exception is propagated afterwards
+            try {
+                instance->preDestroy();
+            } catch (...) {
+                release(slot);
+                throw;
+            }
+        }
+        release(slot);
     }
 
-    template <typename TInterface, typename... TArgs>
-    auto& instantiateTrivial(TArgs&&... args) {
-        item = new TTypeMapping::Type{ std::forward<TArgs>(args)... };
+    void preFork(details::ItemSlot& slot) {
+        if constexpr (requires(TTypeMapping::Type& instance) { instance.preFork(); }) {
+            static_cast<TTypeMapping::Type*>(slot.instance)->preFork();
+        }
+    }
 
-        if constexpr (requires { item->postCreate(); }) {
-            item->postCreate();
+    void postForkParent(details::ItemSlot& slot) {
+        if constexpr (requires(TTypeMapping::Type& instance) { instance.postForkParent(); }) {
+            static_cast<TTypeMapping::Type*>(slot.instance)->postForkParent();
         }
+    }
 
-        return static_cast<TInterface&>(*item);
+    void postForkChild(details::ItemSlot& slot) {
+        if constexpr (requires(TTypeMapping::Type& instance) { instance.postForkChild(); }) {
+            static_cast<TTypeMapping::Type*>(slot.instance)->postForkChild();
+        }
     }
 
-    void destroy() {
-        if constexpr (requires { item->preDestroy(); }) {
-            item->preDestroy();
+    template <typename... TArgs>
+    auto* construct(TArgs&&... args) {
+        using Type = TTypeMapping::Type;
+
+        if constexpr (TTypeMapping::Storage == ItemStorage::InPlace) {
+            return ::new (static_cast<void*>(buffer.bytes)) Type{ std::forward<TArgs>(args)... };
+        } else {
+            return new Type{ std::forward<TArgs>(args)... };
         }
-        delete item;
+    }
+
+    void release(details::ItemSlot& slot) {
+        using Type = TTypeMapping::Type;
+        Type* instance = static_cast<Type*>(slot.instance);
+
+        if constexpr (TTypeMapping::Storage == ItemStorage::InPlace) {
+            // storage belongs to the 'Container' so only end the lifetime of the instance
+            instance->~Type();
+        } else {
+            delete instance;
+        }
+        slot.instance = nullptr;
     }
 
 private:
+    // External instance (DI instances are kept within the 'Container' slots, see 'details::ItemSlot')
     TTypeMapping::Type* item{};
+    // teardown wave: the item is destroyed after every item with the greater level (see 'Container::destroyAllParallel')
+    std::size_t level{};
     TTypeMapping::CtorArgsTuple ctorArgs;
+    // 'postCreateAsync' has been already started (see 'Container::resolveAllAsync')
+    bool asyncCreated{};
+    [[no_unique_address]] details::ItemBuffer<typename TTypeMapping::Type, TTypeMapping::Storage> buffer;
 };
 
 template <typename T>
@@ -159,19 +457,108 @@ class ContainerSliceWeak;
 template <typename... TInterfaces>
 class ContainerSliceWeakLazy;
 
+template <typename... TInterfaces>
+class ContainerSliceCached;
+
+template <typename... TInterfaces>
+class ContainerViewCached;
+
 using EmptyDependenciesChain = TypeList<>;
 class EmptyContainer;
 
-class ContainerBase : public std::enable_shared_from_this<ContainerBase> {
-public:
-    virtual ~ContainerBase() = default;
-    virtual void resolveAll() = 0;
+// all the interfaces which may be found through the base container ('EmptyContainer' has none)
+template <typename TBaseContainer>
+struct BaseContainerInterfaces {
+    using type = TypeList<>;
+};
+
+template <typename TContainer>
+struct BaseContainerInterfaces<std::shared_ptr<TContainer>> {
+    using type = TContainer::FlatInterfaces;
+};
+
+template <typename... TInterfaces>
+struct BaseContainerInterfaces<ContainerSlice<TInterfaces...>> {
+    using type = TypeList<TInterfaces...>;
+};
+
+// see 'makeScopedContainer'
+template <typename... TInterfaces>
+struct BaseContainerInterfaces<ContainerView<TInterfaces...>> {
+    using type = TypeList<TInterfaces...>;
+};
+
+template <typename TBaseContainer>
+struct BaseContainerInterfaces<details::ScopedBase<TBaseContainer>> {
+    using type = BaseContainerInterfaces<TBaseContainer>::type;
+};
+
+// 'Container<...>' type of the base container, 'void' unless it is a 'std::shared_ptr<Container<...>>'
+template <typename TBaseContainer>
+struct BaseContainerType {
+    using type = void;
+};
+
+template <typename TContainer>
+struct BaseContainerType<std::shared_ptr<TContainer>> {
+    using type = TContainer;
+};
+
+// outcome of 'Container::destroyAllParallel'
+struct TeardownReport {
+    struct Overrun {
+        // type registered within the container
+        std::string_view name;
+        // 'preDestroy' + destructor
+        std::chrono::steady_clock::duration duration;
+    };
+
+    // items which were still being destroyed when the deadline had passed
+    std::vector<Overrun> overruns;
+    std::chrono::steady_clock::duration elapsed{};
+    std::size_t wavesCount{};
+
+    bool withinDeadline() const {
+        return overruns.empty();
+    }
 };
 
 template <typename TBaseContainer, typename... TTypeMappings>
 class Container : public ContainerBase {
-    using DestroyItemFn = void (*)(Container&);
+    // should be able to access the flattened base containers chain of the base 'Container<...>'
+    template <typename UBaseContainer, typename... UTypeMappings>
+    friend class Container;
+
+    template <typename UContainer, typename UInterface>
+    friend details::VTableLink<UInterface> details::vtableLinkOf(ContainerBase* container);
+
+    using ItemFn = void (*)(Container&);
+
+    // type-erased operations on the created item, a single static table per registered item (see 'itemOps')
+    struct ItemOps {
+        ItemFn destroy{};
+        std::string_view (*name)(){};
+        // fork customization points of the item (see 'Container::preFork')
+        ItemFn preFork{};
+        ItemFn postForkParent{};
+        ItemFn postForkChild{};
+    };
+
+    struct Deleter {
+        const ItemOps* ops{};
+        std::size_t level{};
+    };
     using AllInterfaces = TypeListMergeT<typename TTypeMappings::Interfaces...>;
+    // interfaces found through the base container (except the ones shadowed by this container)
+    using InheritedInterfaces = TypeListExcludeT<typename BaseContainerInterfaces<TBaseContainer>::type, AllInterfaces>;
+    using BaseContainer = BaseContainerType<TBaseContainer>::type;
+
+    // made by 'makeScopedContainer': the references to the container are not counted at all
+    static constexpr bool IsScoped = details::IsScopedBase<TBaseContainer>;
+
+    // only DI items are ever destroyed by the container so this is the upper bound of the deleters count
+    static constexpr std::size_t DIItemsCount = ((TTypeMappings::Lifetime == ItemLifetime::DI ? 1 : 0) + ... + 0);
+    static constexpr std::array<bool, sizeof...(TTypeMappings)> IsDIItem{ (TTypeMappings::Lifetime == ItemLifetime::DI)... };
 
     static constexpr auto DuplicateIndex = AllInterfaces::findDuplicate();
     static_assert(DuplicateIndex == -1 || liant::Print<decltype(AllInterfaces::template at<DuplicateIndex>())>,
@@ -180,16 +567,18 @@ class Container : public ContainerBase {
 
 public:
     using RegisteredItems = TypeList<RegisteredItem<TTypeMappings>...>;
+    // interfaces registered within this container followed by the ones inherited from the base containers
+    using FlatInterfaces = TypeListMergeT<AllInterfaces, InheritedInterfaces>;
 
     Container(TBaseContainer baseContainer, RegisteredItem<TTypeMappings>... items)
         : items{ items... }
         , baseContainer(std::move(baseContainer)) {
-        deleters.reserve(sizeof...(TTypeMappings));
+        linkInherited(InheritedInterfaces{});
     }
     virtual ~Container() override {
         // destroy items in the order opposite to the creation order
-        for (auto i = deleters.size(); i > 0; --i) {
-            deleters[i - 1](*this);
+        for (auto i = deletersCount.load(std::memory_order_relaxed); i > 0; --i) {
+            deleters[i - 1].ops->destroy(*this);
         }
     }
 
@@ -204,7 +593,7 @@ public:
     // returned fat 'SharedRef' protects 'Container' from being destroyed so use 'SharedRef' with caution (you don't really want block 'Container' deletion)
     template <typename TInterface>
     [[nodiscard]] SharedPtr<TInterface> find() const {
-        return SharedPtr<TInterface>(findInternal<TInterface>(), Container::shared_from_this());
+        return SharedPtr<TInterface>(findInternal<TInterface>(), details::ContainerOwner::of(*this));
     }
 
     // resolve an instance of type registered 'as TInterface'
@@ -229,7 +618,41 @@ public:
     template <typename TInterface, typename... TArgs>
     SharedRef<TInterface> resolve(TArgs&&... args) {
         return SharedRef<TInterface>(resolveInternal<TInterface, EmptyDependenciesChain>(std::forward<TArgs>(args)...),
-            Container::shared_from_this());
+            details::ContainerOwner::of(*this));
+    }
+
+    // resolve several instances registered 'as TInterfaces...' at once (one by one, left to right)
+    // returned 'SharedBundle' holds a single reference to the 'Container' for all of them (see 'liant::SharedBundle')
+    // e.g. 'auto [logger, config] = container->resolveMany<Logger, Config>();'
+    template <typename... TInterfaces>
+    SharedBundle<TInterfaces...> resolveMany() {
+        return SharedBundle<TInterfaces...>{ details::ContainerOwner::of(*this),
+            resolveInternal<TInterfaces, EmptyDependenciesChain>()... };
+    }
+
+    // resolve an instance of type registered 'as TInterface' and return it as the registered concrete 'Type' (not 'TInterface')
+    // the unsafe raw reference is being returned here so make sure it doesn't outlive the 'Container' itself
+    //
+    // nothing is type-erased here so the compiler is able to devirtualize (and inline) the calls made through the returned
+    // reference (e.g. if the registered 'Type' or the called method is 'final')
+    // the base container should be a 'Container<...>' as well (concrete types behind 'ContainerSlice<...>' are erased)
+    template <typename TInterface, typename... TArgs>
+    auto& resolveConcrete(TArgs&&... args) {
+        if constexpr (constexpr std::ptrdiff_t itemIndex = findItemIndex<TInterface>(); itemIndex != -1) {
+            using TRegisteredItem = std::remove_reference_t<decltype(getItem<itemIndex>())>;
+            using Type = TRegisteredItem::Mapping::Type;
+
+            resolveInternal<TInterface, EmptyDependenciesChain>(std::forward<TArgs>(args)...);
+            return *getInstance<Type, itemIndex>();
+        } else if constexpr (requires { baseContainer->template resolveConcrete<TInterface>(std::forward<TArgs>(args)...); }) {
+            return baseContainer->template resolveConcrete<TInterface>(std::forward<TArgs>(args)...);
+        } else {
+            static_assert(liant::Print<TInterface>,
+                "Cannot resolve a concrete 'Type' behind an interface registered within 'liant::ContainerSlice<...>' base "
+                "container. The reason is that 'liant::ContainerSlice<...>' erases 'liant::Container<...>' type under the hood "
+                "(search 'liant::Print' in the compilation output for details)");
+            return resolveInternal<TInterface, EmptyDependenciesChain>(std::forward<TArgs>(args)...);
+        }
     }
 
     // resolve all registered instances automatically
@@ -248,6 +671,182 @@ public:
         });
     }
 
+    // resolve all registered instances (see 'resolveAll') and take a read-only snapshot of them (see 'liant::FrozenContainer')
+    // the container itself stays as it is: the snapshot is the one to share with other threads
+    FrozenContainer<Container> freeze() {
+        resolveAll();
+        return FrozenContainer<Container>(*this);
+    }
+
+    // same as 'resolveAll' but every registered item is being resolved as a separate task on the provided executor
+    // independent branches of the dependencies graph are created simultaneously while dependencies order is still respected:
+    // if an item depends on the item being created by other thread right now then it waits for that item to be created
+    // base container is resolved first (in parallel as well if it is a 'Container<...>')
+    // blocks until all items are created, rethrows the first exception thrown by any of the items
+    //
+    // 'executor' is a callable which accepts a nullary task and runs it eventually on any thread (see 'liant::Executor')
+    template <Executor TExecutor>
+    void resolveAllParallel(TExecutor&& executor) {
+        if constexpr (requires { baseContainer->resolveAllParallel(executor); }) {
+            baseContainer->resolveAllParallel(executor);
+        } else {
+            baseContainer->resolveAll();
+        }
+
+        details::TaskGroup tasks;
+
+        liant::tuple::forEach(items, [&]<typename TTypeMapping>(RegisteredItem<TTypeMapping>&) {
+            if constexpr (TTypeMapping::Lifetime == ItemLifetime::DI) {
+                tasks.run(executor, [this] { //
+                    instantiateAll<EmptyDependenciesChain>(typename TTypeMapping::Interfaces{});
+                });
+            }
+        });
+
+        tasks.wait();
+    }
+
+    // same as 'resolveAll' but also awaits async initialization of the items ('postCreateAsync' customization point)
+    // all items are created (and 'postCreate'-d) synchronously first, then 'postCreateAsync' of the items are started
+    // in the dependencies order: every item is initialized only after its dependencies are, independent items are
+    // initialized simultaneously (e.g. their I/O waits overlap), base container is initialized first
+    // the task is finished once the whole dependencies graph is initialized, rethrows the first exception thrown by 'postCreateAsync'
+    //
+    // 'postCreateAsync' may return any awaitable, it is only ever awaited here (items created by other means later on are not
+    // initialized asynchronously until 'resolveAllAsync' is called again)
+    // the returned task keeps the container alive
+    Task resolveAllAsync() {
+        return resolveAllAsyncInternal(this, details::ContainerOwner::of(*this));
+    }
+
+    // base containers are frozen as well (see 'ContainerBase::freezeForFork') and pinned by this container: the base
+    // container is kept alive until this one is destroyed even though the references to it aren't counted anymore
+    // call it once the whole dependencies graph is resolved (e.g. right after 'resolveAll')
+    virtual void freezeForFork() override {
+        // pin before freezing: the base container may be owned by nothing else but 'baseContainer' slice
+        basePin = pinBase();
+        baseContainer->freezeForFork();
+        ContainerBase::freezeForFork();
+    }
+
+    // created items are notified in the order opposite to the creation order (dependents stop before their dependencies),
+    // base container is notified last
+    // must not race with resolving items from this container (same as 'fork()' must not race with anything)
+    virtual void preFork() override {
+        for (auto i = deletersCount.load(std::memory_order_relaxed); i > 0; --i) {
+            deleters[i - 1].ops->preFork(*this);
+        }
+        baseContainer->preFork();
+    }
+
+    // base container is notified first, then the created items in the creation order (same as 'postCreate')
+    virtual void postForkParent() override {
+        baseContainer->postForkParent();
+        for (std::size_t i = 0, count = deletersCount.load(std::memory_order_relaxed); i < count; ++i) {
+            deleters[i].ops->postForkParent(*this);
+        }
+    }
+
+    // see 'postForkParent'
+    virtual void postForkChild() override {
+        baseContainer->postForkChild();
+        for (std::size_t i = 0, count = deletersCount.load(std::memory_order_relaxed); i < count; ++i) {
+            deleters[i].ops->postForkChild(*this);
+        }
+    }
+
+    // destroy all created items right away, destroying independent items simultaneously on the provided executor
+    // items are split into waves: the item is only destroyed once all the items that depend on it are destroyed
+    // (dependencies are those resolved while the item was being created; item that got lazy view/slice is conservatively
+    // treated as depending on every item created before it)
+    // every wave is finished before the next one starts, base container is not touched
+    //
+    // 'deadline' is the time budget for the whole teardown: items can't be abandoned so all of them are destroyed anyway
+    // but the ones which were still being destroyed after the deadline had passed are reported
+    // the first exception thrown by 'preDestroy' (or by the executor rejecting a task) is rethrown once all the items are
+    // destroyed, the items whose tasks were rejected are destroyed on the calling thread
+    //
+    // must not race with resolving items from this container, once done nothing can be resolved from the container anymore
+    template <Executor TExecutor>
+    TeardownReport destroyAllParallel(TExecutor&& executor, std::chrono::steady_clock::duration deadline) {
+        using Clock = std::chrono::steady_clock;
+
+        const std::size_t count = deletersCount.exchange(0, std::memory_order_relaxed);
+        const Clock::time_point startedAt = Clock::now();
+
+        const Clock::time_point deadlineAt = startedAt + deadline;
+
+        // indices of 'deleters' grouped by the waves, the latest created items go first within a wave
+        std::array<std::size_t, DIItemsCount> order{};
+        std::array<Clock::time_point, DIItemsCount> finishedAt{};
+        std::array<Clock::duration, DIItemsCount> durations{};
+
+        for (std::size_t i = 0; i < count; ++i) {
+            order[i] = count - 1 - i;
+        }
+        std::stable_sort(order.begin(), order.begin() + count, [this](std::size_t lhs, std::size_t rhs) { //
+            return deleters[lhs].level > deleters[rhs].level;
+        });
+
+        TeardownReport report;
+        std::exception_ptr error;
+
+        for (std::size_t waveBegin = 0; waveBegin < count;) {
+            const std::size_t level = deleters[order[waveBegin]].level;
+            std::size_t waveEnd = waveBegin;
+
+            {
+                details::TaskGroup tasks;
+                for (; waveEnd < count && deleters[order[waveEnd]].level == level; ++waveEnd) {
+                    auto destroyItem = [this, idx = order[waveEnd], &finishedAt, &durations] {
+                        const Clock::time_point itemStartedAt = Clock::now();
+                        deleters[idx].ops->destroy(*this);
+                        finishedAt[idx] = Clock::now();
+                        durations[idx] = finishedAt[idx] - itemStartedAt;
+                    };
+
+                    try {
+                        tasks.run(executor, destroyItem);
+                    } catch (...) {
+                        // the executor has rejected the task: the item is destroyed on the calling thread instead
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                        try {
+                            destroyItem();
+                        } catch (...) {
+                            // the executor's exception is the first one already
+                        }
+                    }
+                }
+
+                try {
+                    tasks.wait();
+                } catch (...) {
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+
+            ++report.wavesCount;
+            waveBegin = waveEnd;
+        }
+
+        report.elapsed = Clock::now() - startedAt;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t idx = order[i];
+            if (finishedAt[idx] > deadlineAt) {
+                report.overruns.push_back({ deleters[idx].ops->name(), durations[idx] });
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return report;
+    }
+
 private:
     // while creating non-trivial dependency you need to create its dependencies first
     // and those dependencies should create theirs dependencies first and so on
@@ -257,32 +856,52 @@ private:
     struct ContainerSliceCtorHook {
         template <typename... TInterfaces>
         operator ContainerSlice<TInterfaces...>() {
-            return ContainerSlice<TInterfaces...>{ std::static_pointer_cast<Container>(container.shared_from_this()) };
+            return ContainerSlice<TInterfaces...>{ container };
         }
 
         template <typename... TInterfaces>
         operator ContainerView<TInterfaces...>() {
-            return ContainerView<TInterfaces...>{ std::static_pointer_cast<Container>(container.shared_from_this()) };
+            return ContainerView<TInterfaces...>{ container };
         }
 
         template <typename... TInterfaces>
         operator ContainerSliceLazy<TInterfaces...>() {
-            return ContainerSliceLazy<TInterfaces...>{ std::static_pointer_cast<Container>(container.shared_from_this()) };
+            details::CreationFrame::dependsOnUnknown(&container);
+            return ContainerSliceLazy<TInterfaces...>{ container };
         }
 
         template <typename... TInterfaces>
         operator ContainerViewLazy<TInterfaces...>() {
-            return ContainerViewLazy<TInterfaces...>{ std::static_pointer_cast<Container>(container.shared_from_this()) };
+            details::CreationFrame::dependsOnUnknown(&container);
+            return ContainerViewLazy<TInterfaces...>{ container };
         }
 
         template <typename... TInterfaces>
         operator ContainerSliceWeak<TInterfaces...>() {
-            return ContainerSliceWeak<TInterfaces...>{ std::static_pointer_cast<Container>(container.shared_from_this()) };
+            static_assert(liant::PrintConditional<!IsScoped, ContainerSliceWeak<TInterfaces...>>,
+                "Items of the scoped Container cannot take ContainerSliceWeak<...>: the references to the scoped Container "
+                "are not counted so it would be always expired (search 'liant::Print' in the compilation output for details)");
+            return ContainerSliceWeak<TInterfaces...>{ container };
+        }
+
+        template <typename... TInterfaces>
+        operator ContainerSliceCached<TInterfaces...>() {
+            return ContainerSliceCached<TInterfaces...>{ container };
+        }
+
+        template <typename... TInterfaces>
+        operator ContainerViewCached<TInterfaces...>() {
+            return ContainerViewCached<TInterfaces...>{ container };
         }
 
         template <typename... TInterfaces>
         operator ContainerSliceWeakLazy<TInterfaces...>() {
-            return ContainerSliceWeakLazy<TInterfaces...>{ std::static_pointer_cast<Container>(container.shared_from_this()) };
+            static_assert(liant::PrintConditional<!IsScoped, ContainerSliceWeakLazy<TInterfaces...>>,
+                "Items of the scoped Container cannot take ContainerSliceWeakLazy<...>: the references to the scoped "
+                "Container are not counted so it would be always expired (search 'liant::Print' in the compilation output "
+                "for details)");
+            details::CreationFrame::dependsOnUnknown(&container);
+            return ContainerSliceWeakLazy<TInterfaces...>{ container };
         }
 
         Container& container;
@@ -292,13 +911,59 @@ private:
     TInterface& resolveInternal(TArgs&&... args) {
         if constexpr (constexpr std::ptrdiff_t itemIndex = findItemIndex<TInterface>(); itemIndex != -1) {
             // if TInterface exists in current container then try to use it
-            return instantiateOne<TInterface, TDependenciesChain>(getItem<itemIndex>(), std::forward<TArgs>(args)...);
+            return instantiateOne<TInterface, TDependenciesChain, itemIndex>(std::forward<TArgs>(args)...);
+        } else if constexpr (InheritedInterfaces::template contains<TInterface>() && sizeof...(TArgs) == 0) {
+            // otherwise go straight to the base container having TInterface (see 'linkInherited')
+            return *findInherited<TInterface, true>();
+        } else if constexpr (InheritedInterfaces::template contains<TInterface>() && !isFoundThroughSlice<TInterface>()) {
+            return linkedContainer<TInterface>().template resolveRaw<TInterface>(std::forward<TArgs>(args)...);
         } else {
-            // otherwise delegate to the base container which may possibly have TInterface
+            // let the base container report the error
             return baseContainer->template resolveRaw<TInterface>(std::forward<TArgs>(args)...);
         }
     }
 
+    // 'owner' keeps the 'Container' alive until the task is finished
+    static Task resolveAllAsyncInternal(Container* self, [[maybe_unused]] details::ContainerOwner owner) {
+        if constexpr (requires { self->baseContainer->resolveAllAsync(); }) {
+            co_await self->baseContainer->resolveAllAsync();
+        } else {
+            self->baseContainer->resolveAll();
+        }
+
+        liant::tuple::forEach(self->items, [&]<typename TTypeMapping>(RegisteredItem<TTypeMapping>&) {
+            self->template instantiateAll<EmptyDependenciesChain>(typename TTypeMapping::Interfaces{});
+        });
+
+        // teardown waves (see 'destroyAllParallel') are the initialization waves as well, just in the reversed order
+        const std::size_t levelsCount = self->maxLevel.load(std::memory_order_relaxed) + 1;
+        for (std::size_t level = 0; level < levelsCount; ++level) {
+            std::vector<Task> wave;
+
+            [&]<std::size_t... ItemIndices>(std::index_sequence<ItemIndices...>) {
+                ([&] {
+                    auto& item = self->template getItem<ItemIndices>();
+                    using Type = std::remove_reference_t<decltype(item)>::Mapping::Type;
+
+                    if constexpr (IsDIItem[ItemIndices] && requires(Type& instance) { instance.postCreateAsync(); }) {
+                        if (Type* instance = self->template getInstance<Type, ItemIndices>();
+                            instance && item.level == level && !item.asyncCreated) {
+                            item.asyncCreated = true;
+                            wave.push_back(postCreateAsync(*instance));
+                        }
+                    }
+                }(), ...);
+            }(std::index_sequence_for<TTypeMappings...>{});
+
+            co_await details::whenAll(std::move(wave));
+        }
+    }
+
+    template <typename T>
+    static Task postCreateAsync(T& instance) {
+        co_await instance.postCreateAsync();
+    }
+
     // TDependenciesChain is there to detect dependencies cycles at compile time
     template <typename TDependenciesChain, typename... TInterfaces>
     void instantiateAll(TypeList<TInterfaces...>) {
@@ -307,54 +972,30 @@ private:
         });
     }
 
-    template <typename TInterface, typename TDependenciesChain, typename TRegisteredItem, typename... TArgs>
-    TInterface& instantiateOne(TRegisteredItem& item, TArgs&&... args) {
-        // ensure items are only instantiated once
-        if (TInterface* existingInterface = item.template get<TInterface>()) {
-            return *existingInterface;
-        }
-
+    template <typename TInterface, typename TDependenciesChain, std::ptrdiff_t ItemIndex, typename... TArgs>
+    TInterface& instantiateOne(TArgs&&... args) {
         static_assert(!TDependenciesChain::template contains<TInterface>(), "Detected cycle in your dependencies");
-        using DependenciesChainNext = TypeListAppendT<TDependenciesChain, TInterface>;
 
-        if constexpr (TRegisteredItem::Mapping::Lifetime == ItemLifetime::DI) {
-            // use directly provided ctor arguments instead of the binded ones
-            if constexpr (sizeof...(TArgs) > 0) {
-                if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, std::shared_ptr<Container>, TArgs&&...>) {
-                    // hook into dependencies (basically liant::ContainerSlice) creation logic and ensure dependencies of those dependencies are created first
-                    ContainerSliceCtorHook<DependenciesChainNext> hook{ *this };
-                    return instantiate<TInterface>(item, hook, std::forward<TArgs>(args)...);
-                } else if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, TArgs&&...>) {
-                    // item depends on nothing from DI container (it is a leaf of a dependencies tree) so it can be created right away
-                    return instantiateTrivial<TInterface>(item, std::forward<TArgs>(args)...);
-                } else {
-                    static_assert(liant::Print<typename TRegisteredItem::Mapping::Type>,
-                        "Cannot create an instance of a type you've registered within DI container. "
-                        "Either you've called 'Container::createAll' but one of the dependencies requires some extra "
-                        "ctor arguments or you've called 'Container::create' and provided wrong ctor arguments "
-                        "(search 'liant::Print' in the compilation output for details)");
-                }
+        auto& item = getItem<ItemIndex>();
+        if constexpr (IsDIItem[ItemIndex]) {
+            details::ItemSlot& slot = getSlot<ItemIndex>();
+
+            // ensure items are only instantiated once (even if the same item is requested from multiple threads)
+            // if other thread is creating this item right now then wait until it is done
+            if (!slot.once.begin()) {
+                details::CreationFrame::dependsOn(this, item.level);
+                return *item.template getCreated<TInterface>(slot);
             }
-            // no directly provided ctor arguments - use binded arguments instead
-            else {
-                return std::apply(
-                    [this, &item]<typename... UArgs>(UArgs&&... args) -> TInterface& {
-                        if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, std::shared_ptr<Container>, UArgs&&...>) {
-                            // hook into dependencies (basically liant::ContainerSlice) creation logic and ensure dependencies of those dependencies are created first
-                            ContainerSliceCtorHook<DependenciesChainNext> hook{ *this };
-                            return instantiate<TInterface>(item, hook, std::forward<UArgs>(args)...);
-                        } else if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, UArgs&&...>) {
-                            // item depends on nothing from DI container (it is a leaf of a dependencies tree) so it can be created right away
-                            return instantiateTrivial<TInterface>(item, std::forward<UArgs>(args)...);
-                        } else {
-                            static_assert(liant::Print<typename TRegisteredItem::Mapping::Type, UArgs...>,
-                                "Cannot create an instance of a type you've registered within DI container. "
-                                "You've provided wrong ctor arguments during DI container bindings setup "
-                                "(search 'liant::Print' in the compilation output for details).");
-                        }
-                    },
-                    // it is safe to move these args coz RegisteredItem may be instantiated only once
-                    std::move(item.ctorArgs));
+
+            try {
+                TInterface& interface = createLeveled<TInterface, TDependenciesChain, ItemIndex>(std::forward<TArgs>(args)...);
+                slot.once.commit();
+                details::CreationFrame::dependsOn(this, item.level);
+                return interface;
+            } catch (...) {
+                // let the next request try again
+                slot.once.rollback();
+                throw;
             }
         } else {
             // External items are always initialized
@@ -362,23 +1003,83 @@ private:
         }
     }
 
-    // TContainerSliceCtorHook may be either 'Container<...>' itself or 'Container<...>::ContainerSliceCtorHook'
-    template <typename TInterface, typename TRegisteredItem, typename TContainerSliceCtorHook, typename... TArgs>
-    TInterface& instantiate(TRegisteredItem& item, TContainerSliceCtorHook& hook, TArgs&&... args) {
-        TInterface& interface = item.template instantiate<TInterface>(hook, std::forward<TArgs>(args)...);
-        // order matters coz 'item.instantiate<TInterface>' may recursisevly instantiate its own dependencies (see 'instantiateAll' mechanism)
-        deleters.push_back(makeDeleter<TInterface>());
+    // create an item and record which teardown wave it belongs to (see 'destroyAllParallel')
+    template <typename TInterface, typename TDependenciesChain, std::ptrdiff_t ItemIndex, typename... TArgs>
+    TInterface& createLeveled(TArgs&&... args) {
+        auto& item = getItem<ItemIndex>();
+
+        details::CreationFrame frame{ this };
+        TInterface& interface = createOne<TInterface, TDependenciesChain>(item, getSlot<ItemIndex>(), std::forward<TArgs>(args)...);
+
+        item.level = frame.getLevel();
+        if (frame.hasUnknownDependencies()) {
+            item.level = std::max(item.level, maxLevel.load(std::memory_order_relaxed) + 1);
+        }
+
+        std::size_t currentMaxLevel = maxLevel.load(std::memory_order_relaxed);
+        while (currentMaxLevel < item.level &&
+            !maxLevel.compare_exchange_weak(currentMaxLevel, item.level, std::memory_order_relaxed)) {
+        }
+
+        // order matters coz 'createOne' may recursisevly instantiate its own dependencies (see 'instantiateAll' mechanism)
+        deleters[deletersCount.fetch_add(1, std::memory_order_relaxed)] = Deleter{ itemOps<ItemIndex>(), item.level };
 
         return interface;
     }
 
-    template <typename TInterface, typename TRegisteredItem, typename... TArgs>
-    TInterface& instantiateTrivial(TRegisteredItem& item, TArgs&&... args) {
-        TInterface& interface = item.template instantiateTrivial<TInterface>(std::forward<TArgs>(args)...);
-        // order matters coz 'item.instantiate<TInterface>' may recursisevly instantiate its own dependencies (see 'instantiateAll' mechanism)
-        deleters.push_back(makeDeleter<TInterface>());
+    template <typename TInterface, typename TDependenciesChain, typename TRegisteredItem, typename... TArgs>
+    TInterface& createOne(TRegisteredItem& item, details::ItemSlot& slot, TArgs&&... args) {
+        using DependenciesChainNext = TypeListAppendT<TDependenciesChain, TInterface>;
 
-        return interface;
+        // use directly provided ctor arguments instead of the binded ones
+        if constexpr (sizeof...(TArgs) > 0) {
+            if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, std::shared_ptr<Container>, TArgs&&...>) {
+                // hook into dependencies (basically liant::ContainerSlice) creation logic and ensure dependencies of those dependencies are created first
+                ContainerSliceCtorHook<DependenciesChainNext> hook{ *this };
+                return instantiate<TInterface>(item, slot, hook, std::forward<TArgs>(args)...);
+            } else if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, TArgs&&...>) {
+                // item depends on nothing from DI container (it is a leaf of a dependencies tree) so it can be created right away
+                return instantiateTrivial<TInterface>(item, slot, std::forward<TArgs>(args)...);
+            } else {
+                static_assert(liant::Print<typename TRegisteredItem::Mapping::Type>,
+                    "Cannot create an instance of a type you've registered within DI container. "
+                    "Either you've called 'Container::createAll' but one of the dependencies requires some extra "
+                    "ctor arguments or you've called 'Container::create' and provided wrong ctor arguments "
+                    "(search 'liant::Print' in the compilation output for details)");
+            }
+        }
+        // no directly provided ctor arguments - use binded arguments instead
+        else {
+            return std::apply(
+                [this, &item, &slot]<typename... UArgs>(UArgs&&... args) -> TInterface& {
+                    if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, std::shared_ptr<Container>, UArgs&&...>) {
+                        // hook into dependencies (basically liant::ContainerSlice) creation logic and ensure dependencies of those dependencies are created first
+                        ContainerSliceCtorHook<DependenciesChainNext> hook{ *this };
+                        return instantiate<TInterface>(item, slot, hook, std::forward<UArgs>(args)...);
+                    } else if constexpr (std::is_constructible_v<typename TRegisteredItem::Mapping::Type, UArgs&&...>) {
+                        // item depends on nothing from DI container (it is a leaf of a dependencies tree) so it can be created right away
+                        return instantiateTrivial<TInterface>(item, slot, std::forward<UArgs>(args)...);
+                    } else {
+                        static_assert(liant::Print<typename TRegisteredItem::Mapping::Type, UArgs...>,
+                            "Cannot create an instance of a type you've registered within DI container. "
+                            "You've provided wrong ctor arguments during DI container bindings setup "
+                            "(search 'liant::Print' in the compilation output for details).");
+                    }
+                },
+                // pass the copies of the binded args: the creation may fail and then the item may be resolved again
+                typename TRegisteredItem::Mapping::CtorArgsTuple(item.ctorArgs));
+        }
+    }
+
+    // TContainerSliceCtorHook may be either 'Container<...>' itself or 'Container<...>::ContainerSliceCtorHook'
+    template <typename TInterface, typename TRegisteredItem, typename TContainerSliceCtorHook, typename... TArgs>
+    TInterface& instantiate(TRegisteredItem& item, details::ItemSlot& slot, TContainerSliceCtorHook& hook, TArgs&&... args) {
+        return item.template instantiate<TInterface>(slot, hook, std::forward<TArgs>(args)...);
+    }
+
+    template <typename TInterface, typename TRegisteredItem, typename... TArgs>
+    TInterface& instantiateTrivial(TRegisteredItem& item, details::ItemSlot& slot, TArgs&&... args) {
+        return item.template instantiateTrivial<TInterface>(slot, std::forward<TArgs>(args)...);
     }
 
     template <typename TInterface>
@@ -399,26 +1100,199 @@ private:
         return std::get<static_cast<std::size_t>(ItemIndex)>(items);
     }
 
+    // DI items only: the index of the item among the DI items
+    template <std::ptrdiff_t ItemIndex>
+    static constexpr std::size_t slotIndex() {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(ItemIndex); ++i) {
+            index += IsDIItem[i] ? 1 : 0;
+        }
+        return index;
+    }
+
+    template <std::ptrdiff_t ItemIndex>
+    details::ItemSlot& getSlot() {
+        constexpr std::size_t index = slotIndex<ItemIndex>();
+        return slots[index];
+    }
+
+    template <std::ptrdiff_t ItemIndex>
+    const details::ItemSlot& getSlot() const {
+        constexpr std::size_t index = slotIndex<ItemIndex>();
+        return slots[index];
+    }
+
+    // nullptr until the item is created (DI items only)
+    template <typename TInterface, std::ptrdiff_t ItemIndex>
+    TInterface* getInstance() const {
+        if constexpr (IsDIItem[ItemIndex]) {
+            return getItem<ItemIndex>().template get<TInterface>(getSlot<ItemIndex>());
+        } else {
+            return getItem<ItemIndex>().template get<TInterface>();
+        }
+    }
+
     template <typename TInterface>
     auto* findInternal() const {
         if constexpr (constexpr std::ptrdiff_t itemIndex = findItemIndex<TInterface>(); itemIndex != -1) {
-            return getItem<itemIndex>().template get<TInterface>();
+            return getInstance<TInterface, itemIndex>();
+        } else if constexpr (InheritedInterfaces::template contains<TInterface>()) {
+            return findInherited<TInterface, false>();
         } else {
+            // let the base container report the error
             return baseContainer->template findRaw<TInterface>();
         }
     }
 
     template <typename TInterface>
-    DestroyItemFn makeDeleter() {
-        return +[](Container& self) {
-            auto& item = self.getItem<findItemIndex<TInterface>()>();
-            item.destroy();
+    static constexpr std::size_t inheritedIndex() {
+        return static_cast<std::size_t>(InheritedInterfaces::find([]<typename UInterface>() { //
+            return std::is_same_v<UInterface, TInterface>;
+        }));
+    }
+
+    // the base containers chain is flattened once the container is created: every inherited interface is linked to the
+    // 'Container<...>' registering it, no matter how deep down the chain it is (base slices included: the interface coming
+    // through the base 'ContainerSlice' is linked to the erased 'Container<...>' behind the slice along with its table item)
+    // so there are no hops through the intermediate base containers and at most one type-erased call
+    // the interfaces themselves are never linked: the items may be destroyed (e.g. 'destroyAllParallel') in the meantime
+    template <typename TInterface>
+    static constexpr bool isFoundThroughSlice() {
+        if constexpr (std::is_void_v<BaseContainer>) {
+            return true;
+        } else if constexpr (BaseContainer::AllInterfaces::template contains<TInterface>()) {
+            return false;
+        } else {
+            return BaseContainer::template isFoundThroughSlice<TInterface>();
+        }
+    }
+
+    template <typename TInterface>
+    static constexpr auto linkedContainerType() {
+        if constexpr (BaseContainer::AllInterfaces::template contains<TInterface>()) {
+            return TypeIdentity<BaseContainer>{};
+        } else {
+            return BaseContainer::template linkedContainerType<TInterface>();
+        }
+    }
+
+    template <typename... TInterfaces>
+    void linkInherited(TypeList<TInterfaces...>) {
+        std::size_t i = 0;
+        ((inheritedLinks[i++] = makeInheritedLink<TInterfaces>()), ...);
+    }
+
+    template <typename TInterface>
+    details::InheritedLink makeInheritedLink() {
+        if constexpr (std::is_void_v<BaseContainer>) {
+            const details::VTableLink<TInterface> link = baseContainer->template linkFor<TInterface>();
+            return details::InheritedLink{ static_cast<void*>(link.container), link.item };
+        } else if constexpr (BaseContainer::AllInterfaces::template contains<TInterface>()) {
+            return details::InheritedLink{ static_cast<void*>(baseContainer.get()) };
+        } else {
+            return baseContainer->inheritedLinks[BaseContainer::template inheritedIndex<TInterface>()];
+        }
+    }
+
+    // the 'Container<...>' registering the interface (see 'details::vtableLinkOf')
+    template <typename TInterface>
+    details::VTableLink<TInterface> linkTo() {
+        if constexpr (findItemIndex<TInterface>() != -1) {
+            return details::VTableLink<TInterface>{ this, details::vtableItemOf<Container, TInterface>() };
+        } else if constexpr (!InheritedInterfaces::template contains<TInterface>()) {
+            // reported by 'findRaw'/'resolveRaw'
+            return details::VTableLink<TInterface>{};
+        } else if constexpr (isFoundThroughSlice<TInterface>()) {
+            const details::InheritedLink& link = inheritedLinks[inheritedIndex<TInterface>()];
+            return details::VTableLink<TInterface>{ static_cast<ContainerBase*>(link.container),
+                static_cast<const details::VTableItem<TInterface>*>(link.item) };
+        } else {
+            return linkedContainer<TInterface>().template linkTo<TInterface>();
+        }
+    }
+
+    template <typename TInterface>
+    auto& linkedContainer() const {
+        using LinkedContainer = decltype(linkedContainerType<TInterface>())::type;
+        return *static_cast<LinkedContainer*>(inheritedLinks[inheritedIndex<TInterface>()].container);
+    }
+
+    // 'Resolve' - create the item if it isn't created yet
+    template <typename TInterface, bool Resolve>
+    TInterface* findInherited() const {
+        if constexpr (isFoundThroughSlice<TInterface>()) {
+            const details::InheritedLink& link = inheritedLinks[inheritedIndex<TInterface>()];
+            const auto* item = static_cast<const details::VTableItem<TInterface>*>(link.item);
+            ContainerBase* container = static_cast<ContainerBase*>(link.container);
+            if constexpr (Resolve) {
+                return &(*item->resolveRawErased)(container);
+            } else {
+                return (*item->findRawErased)(container);
+            }
+        } else if constexpr (Resolve) {
+            return &linkedContainer<TInterface>().template resolveInternal<TInterface, EmptyDependenciesChain>();
+        } else {
+            return linkedContainer<TInterface>().template findInternal<TInterface>();
+        }
+    }
+
+    details::ForkPin pinBase() const {
+        if constexpr (!std::is_void_v<BaseContainer>) {
+            return details::ForkPin::of(baseContainer.get());
+        } else if constexpr (requires { baseContainer->pinForFork(); }) {
+            return baseContainer->pinForFork();
+        } else {
+            // 'EmptyContainer'
+            return details::ForkPin{};
+        }
+    }
+
+    template <std::ptrdiff_t ItemIndex>
+    static const ItemOps* itemOps() {
+        static constexpr ItemOps ops{
+            .destroy =
+                +[](Container& self) {
+                    auto& item = self.getItem<ItemIndex>();
+                    item.destroy(self.getSlot<ItemIndex>());
+                },
+            .name =
+                +[] {
+                    using TRegisteredItem = std::tuple_element_t<ItemIndex, std::tuple<RegisteredItem<TTypeMappings>...>>;
+                    return details::typeName<typename TRegisteredItem::Mapping::Type>();
+                },
+            .preFork =
+                +[](Container& self) {
+                    auto& item = self.getItem<ItemIndex>();
+                    item.preFork(self.getSlot<ItemIndex>());
+                },
+            .postForkParent =
+                +[](Container& self) {
+                    auto& item = self.getItem<ItemIndex>();
+                    item.postForkParent(self.getSlot<ItemIndex>());
+                },
+            .postForkChild =
+                +[](Container& self) {
+                    auto& item = self.getItem<ItemIndex>();
+                    item.postForkChild(self.getSlot<ItemIndex>());
+                },
         };
+        return &ops;
     }
 
 private:
     std::tuple<RegisteredItem<TTypeMappings>...> items;
-    std::vector<DestroyItemFn> deleters;
+    // hot state of the DI items (see 'details::ItemSlot')
+    std::array<details::ItemSlot, DIItemsCount> slots{};
+    // each DI item is created at most once so fixed-size storage is enough (no allocation per container)
+    std::array<Deleter, DIItemsCount> deleters{};
+    // items may be created concurrently (see 'resolveAllParallel')
+    std::atomic<std::size_t> deletersCount{};
+    // the greatest teardown wave level among the created items
+    std::atomic<std::size_t> maxLevel{};
+    // flattened base containers chain: 'Container<...>' registering the inherited interface (see 'linkInherited')
+    std::array<details::InheritedLink, std::max<std::size_t>(InheritedInterfaces::size(), 1)> inheritedLinks{};
+    // set once frozen (see 'freezeForFork'), released after 'baseContainer' (it may be the last owner of the base)
+    details::ForkPin basePin;
     TBaseContainer baseContainer;
 };
 
@@ -439,6 +1313,22 @@ public:
         // do nothing
     }
 
+    void freezeForFork() {
+        // do nothing
+    }
+
+    void preFork() {
+        // do nothing
+    }
+
+    void postForkParent() {
+        // do nothing
+    }
+
+    void postForkChild() {
+        // do nothing
+    }
+
     template <typename TInterface, typename TDependenciesChain, typename... TArgs>
     TInterface& resolveInternal(TArgs&&...) {
         static_assert(liant::Print<TInterface>,
@@ -446,6 +1336,13 @@ public:
             "(search 'liant::Print' in the compilation output for details)");
     }
 
+    template <typename TInterface, typename... TArgs>
+    TInterface& resolveConcrete(TArgs&&...) {
+        static_assert(liant::Print<TInterface>,
+            "You're trying to resolve an interface which isn't registered within DI container "
+            "(search 'liant::Print' in the compilation output for details)");
+    }
+
     template <typename TInterface>
     constexpr std::ptrdiff_t findItemIndex() {
         return -1;
@@ -469,18 +1366,37 @@ auto baseContainer(const ContainerSlice<TInterfaces...>& containerSlice) {
     return containerSlice;
 }
 
+// the references to the 'Container' are counted according to the 'policy' (see 'liant::OwnershipPolicy')
+template <typename... TTypeMappings>
+auto makeContainer(OwnershipPolicy policy, RegisteredItem<TTypeMappings>... items) {
+    return details::makeContainerWithPolicy<liant::Container<EmptyContainer, TTypeMappings...>>(policy, EmptyContainer{}, items...);
+}
+
+template <typename TBaseContainer, typename... TTypeMappings>
+auto makeContainer(OwnershipPolicy policy, const std::shared_ptr<TBaseContainer>& baseContainer, RegisteredItem<TTypeMappings>... items) {
+    return details::makeContainerWithPolicy<liant::Container<std::shared_ptr<TBaseContainer>, TTypeMappings...>>(
+        policy, baseContainer, items...);
+}
+
+template <typename... TBaseTypes, typename... TTypeMappings>
+auto makeContainer(OwnershipPolicy policy, const ContainerSlice<TBaseTypes...>& baseContainer, RegisteredItem<TTypeMappings>... items) {
+    return details::makeContainerWithPolicy<liant::Container<ContainerSlice<TBaseTypes...>, TTypeMappings...>>(
+        policy, baseContainer, items...);
+}
+
+// same as the above with 'OwnershipPolicy::Atomic'
 template <typename... TTypeMappings>
 auto makeContainer(RegisteredItem<TTypeMappings>... items) {
-    return std::make_shared<liant::Container<EmptyContainer, TTypeMappings...>>(EmptyContainer{}, items...);
+    return makeContainer(OwnershipPolicy::Atomic, items...);
 }
 
 template <typename TBaseContainer, typename... TTypeMappings>
 auto makeContainer(const std::shared_ptr<TBaseContainer>& baseContainer, RegisteredItem<TTypeMappings>... items) {
-    return std::make_shared<liant::Container<std::shared_ptr<TBaseContainer>, TTypeMappings...>>(baseContainer, items...);
+    return makeContainer(OwnershipPolicy::Atomic, baseContainer, items...);
 }
 
 template <typename... TBaseTypes, typename... TTypeMappings>
 auto makeContainer(const ContainerSlice<TBaseTypes...>& baseContainer, RegisteredItem<TTypeMappings>... items) {
-    return std::make_shared<liant::Container<ContainerSlice<TBaseTypes...>, TTypeMappings...>>(baseContainer, items...);
+    return makeContainer(OwnershipPolicy::Atomic, baseContainer, items...);
 }
 } // namespace liant
\ No newline at end of file
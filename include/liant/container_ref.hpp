@@ -0,0 +1,77 @@
+#pragma once
+#include "liant/container.hpp"
+#include "liant/export_macro.hpp"
+#include "liant/ptr.hpp"
+#include "liant/typelist.hpp"
+
+#ifndef LIANT_MODULE
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// subset of the DI container which is NOT type-erased (non-owning reference) - use it where the full 'Container<...>' type is known
+// interfaces are resolved upon the construction (see 'Container::resolveConcrete'), pointers to the registered concrete
+// 'Types' are stored within the ref itself
+//
+// unlike 'ContainerView<...>' the accessors return the registered concrete 'Type' rather than the interface so the compiler
+// is able to devirtualize (and inline) the calls made through them (e.g. if the registered 'Type' or the called method is 'final')
+//
+// auto container = liant::makeContainer(liant::registerInstanceOf<ConsoleLogger>().as<Logger>());
+// liant::ContainerRef<decltype(container)::element_type, Logger> ref(container);
+// ConsoleLogger& logger = ref.resolveRaw<Logger>();
+template <typename TContainer, typename... TInterfaces>
+class ContainerRef {
+public:
+    // concrete 'Type' registered 'as TInterface'
+    template <typename TInterface>
+    using ConcreteType = std::remove_reference_t<decltype(std::declval<TContainer&>().template resolveConcrete<TInterface>())>;
+
+    template <typename TInterface>
+    using concrete_type = ConcreteType<TInterface>;
+
+    ContainerRef(const std::shared_ptr<TContainer>& container)
+        : ContainerRef(*container) {}
+
+    ContainerRef(TContainer& container)
+        : container(std::addressof(container))
+        , resolved{ std::addressof(container.template resolveConcrete<TInterfaces>())... } {}
+
+    // trying to find already created instance registered 'as TInterface'
+    // the unsafe raw pointer is being returned here so make sure it doesn't outlive the underlying 'Container'
+    template <typename TInterface>
+    [[nodiscard]] ConcreteType<TInterface>* findRaw() const {
+        static_assert(liant::PrintConditional<TypeList<TInterfaces...>::template contains<TInterface>(), TInterface>,
+            "Interface you're trying to find is missing from ContainerRef<...> "
+            "(search 'liant::Print' in the compilation output for details)");
+
+        constexpr std::ptrdiff_t index = TypeList<TInterfaces...>::find([]<typename T>() { return std::is_same_v<T, TInterface>; });
+        return std::get<static_cast<std::size_t>(index)>(resolved);
+    }
+
+    // resolve an instance of type registered 'as TInterface' (already resolved upon the construction)
+    // the unsafe raw reference is being returned here so make sure it doesn't outlive the underlying 'Container'
+    template <typename TInterface>
+    ConcreteType<TInterface>& resolveRaw() const {
+        return *findRaw<TInterface>();
+    }
+
+    // resolve an instance of type registered 'as TInterface' (already resolved upon the construction)
+    // returned fat 'SharedRef' protects 'Container' from being destroyed so use 'SharedRef' with caution (you don't really want block 'Container' deletion)
+    template <typename TInterface>
+    SharedRef<ConcreteType<TInterface>> resolve() const {
+        return SharedRef<ConcreteType<TInterface>>(resolveRaw<TInterface>(), details::ContainerOwner::of(*container));
+    }
+
+private:
+    TContainer* container;
+    std::tuple<ConcreteType<TInterfaces>*...> resolved;
+};
+} // namespace liant
@@ -4,6 +4,7 @@
 
 #ifndef LIANT_MODULE
 #include <memory>
+#include <utility>
 #endif
 
 // clang-format off
@@ -22,7 +23,7 @@ public:
         return this->container.operator bool();
     }
     auto useCount() const {
-        return this->container.asShared().use_count();
+        return this->container.asShared().useCount();
     }
 };
 
@@ -38,7 +39,25 @@ public:
         return this->container.operator bool();
     }
     auto useCount() const {
-        return this->container.asShared().use_count();
+        return this->container.asShared().useCount();
+    }
+};
+
+// subset of another type-erased DI container (shared ownership)
+// interfaces are resolved upon the construction and pointers to them are stored within the slice itself
+// so accessing the dependencies is just a load (no type-erased call into the container)
+template <typename... TInterfaces>
+class ContainerSliceCached
+    : public details::ContainerSliceImpl<details::SharedOwnershipCached, ContainerSliceCached<TInterfaces...>> {
+public:
+    using details::ContainerSliceImpl<details::SharedOwnershipCached, ContainerSliceCached>::ContainerSliceImpl;
+    using details::ContainerSliceImpl<details::SharedOwnershipCached, ContainerSliceCached>::operator=;
+
+    explicit operator bool() const {
+        return this->container.operator bool();
+    }
+    auto useCount() const {
+        return this->container.asShared().useCount();
     }
 };
 
@@ -49,9 +68,22 @@ public:
     using details::ContainerSliceImpl<details::WeakOwnership, ContainerSliceWeak>::ContainerSliceImpl;
     using details::ContainerSliceImpl<details::WeakOwnership, ContainerSliceWeak>::operator=;
 
+    // empty slice if the 'Container' is gone
     ContainerSlice<TInterfaces...> lock() const {
         return ContainerSlice<TInterfaces...>(*this);
     }
+
+    // pin the 'Container' once for the whole 'fn(slice)' call: any number of lookups through the 'slice' cost the same
+    // as through 'ContainerSlice' (no locking per lookup) and the 'Container' is kept alive until 'fn' returns
+    // 'fn' isn't called at all if the 'Container' is gone, returns whether it was called
+    template <typename TFn>
+    bool withLocked(TFn&& fn) const {
+        if (ContainerSlice<TInterfaces...> slice = lock()) {
+            std::forward<TFn>(fn)(slice);
+            return true;
+        }
+        return false;
+    }
 };
 
 
@@ -63,8 +95,19 @@ public:
     using details::ContainerSliceImpl<details::WeakOwnershipLazy, ContainerSliceWeakLazy>::ContainerSliceImpl;
     using details::ContainerSliceImpl<details::WeakOwnershipLazy, ContainerSliceWeakLazy>::operator=;
 
+    // empty slice if the 'Container' is gone
     ContainerSliceLazy<TInterfaces...> lock() const {
         return ContainerSliceLazy<TInterfaces...>(*this);
     }
+
+    // see 'ContainerSliceWeak::withLocked'
+    template <typename TFn>
+    bool withLocked(TFn&& fn) const {
+        if (ContainerSliceLazy<TInterfaces...> slice = lock()) {
+            std::forward<TFn>(fn)(slice);
+            return true;
+        }
+        return false;
+    }
 };
 } // namespace liant
\ No newline at end of file
@@ -19,6 +19,17 @@ public:
     using details::ContainerSliceImpl<details::NonOwningRef, ContainerView>::operator=;
 };
 
+// subset of another type-erased DI container (non-owning reference) - basically non-owning version of liant::ContainerSliceCached
+// interfaces are resolved upon the construction and pointers to them are stored within the view itself
+// so accessing the dependencies is just a load (no type-erased call into the container)
+template <typename... TInterfaces>
+class ContainerViewCached
+    : public details::ContainerSliceImpl<details::NonOwningRefCached, ContainerViewCached<TInterfaces...>> {
+public:
+    using details::ContainerSliceImpl<details::NonOwningRefCached, ContainerViewCached>::ContainerSliceImpl;
+    using details::ContainerSliceImpl<details::NonOwningRefCached, ContainerViewCached>::operator=;
+};
+
 // subset of another type-erased DI container (non-owning reference) - basically non-owning version of liant::ContainerSliceLazy
 template <typename... TInterfaces>
 class ContainerViewLazy : public details::ContainerSliceImpl<details::NonOwningRefLazy, ContainerViewLazy<TInterfaces...>> {
@@ -5,7 +5,8 @@
 // LIANT_DEPENDENCY(HttpClient, httpClient)
 // ...
 // liant::ContainerView<HttpClient, ...> di;
-// di.httpClient();
+// di.httpClient()->get(url);   // borrowed for the duration of the statement, no reference counting (see 'liant::Borrowed')
+// di.httpClientRaw().get(url);  // plain reference
 //
 // Note: LIANT_DEPENDENCY macro can be used from your namespace as well - no need to open liant:: namespace
 #define LIANT_DEPENDENCY(Interface, getterPrettyName)                                                                  \
@@ -16,8 +17,8 @@
         Interface& getterPrettyName##Raw() const {                                                                     \
             return *static_cast<const TContainer*>(this)->template findRaw<Interface>();                               \
         }                                                                                                              \
-        liant::SharedRef<Interface> getterPrettyName() const {                                                         \
-            return static_cast<const TContainer*>(this)->template find<Interface>().toSharedRef();                     \
+        liant::Borrowed<Interface> getterPrettyName() const {                                                          \
+            return static_cast<const TContainer*>(this)->template borrow<Interface>();                                 \
         }                                                                                                              \
     };                                                                                                                 \
                                                                                                                        \
@@ -34,8 +35,8 @@
         Interface& getterPrettyName##Raw() {                                                                           \
             return static_cast<TContainer*>(this)->template resolveRaw<Interface>();                                   \
         }                                                                                                              \
-        liant::SharedRef<Interface> getterPrettyName() {                                                               \
-            return static_cast<TContainer*>(this)->template resolve<Interface>();                                      \
+        liant::Borrowed<Interface> getterPrettyName() {                                                                \
+            return static_cast<TContainer*>(this)->template borrow<Interface>();                                       \
         }                                                                                                              \
     };                                                                                                                 \
                                                                                                                        \
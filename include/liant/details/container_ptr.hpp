@@ -25,8 +25,12 @@ struct ContainerPtr<OwnershipKind::RawRef> {
     ContainerPtr(const ContainerPtr<OwnershipOther>& containerPtr)
         : inner(containerPtr.asRaw()) {}
 
-    ContainerPtr(std::shared_ptr<ContainerBase> container)
-        : inner(container.get()) {}
+    // nullable (the slice/view made out of an empty 'std::shared_ptr' is empty)
+    ContainerPtr(const ContainerBase* container)
+        : inner(const_cast<ContainerBase*>(container)) {}
+
+    ContainerPtr(const ContainerBase& container)
+        : inner(const_cast<ContainerBase*>(&container)) {}
 
     explicit operator bool() const {
         return inner != nullptr;
@@ -34,17 +38,17 @@ struct ContainerPtr<OwnershipKind::RawRef> {
     ContainerBase* asRaw() const {
         return inner;
     }
-    std::shared_ptr<ContainerBase> asShared() const {
-        return inner->shared_from_this();
+    ContainerOwner asShared() const {
+        return ContainerOwner::of(*inner);
     }
-    std::weak_ptr<ContainerBase> asWeak() const {
-        return inner->shared_from_this();
+    ContainerWeakOwner asWeak() const {
+        return ContainerWeakOwner::of(*inner);
     }
 };
 
 template <>
 struct ContainerPtr<OwnershipKind::Shared> {
-    std::shared_ptr<ContainerBase> inner{};
+    ContainerOwner inner{};
 
     ContainerPtr() = default;
     ContainerPtr(const ContainerPtr&) = default;
@@ -56,8 +60,11 @@ struct ContainerPtr<OwnershipKind::Shared> {
     ContainerPtr(const ContainerPtr<OwnershipOther>& containerPtr)
         : inner(containerPtr.asShared()) {}
 
-    ContainerPtr(std::shared_ptr<ContainerBase> container)
-        : inner(std::move(container)) {}
+    ContainerPtr(const ContainerBase* container)
+        : inner(container ? ContainerOwner::of(*container) : nullptr) {}
+
+    ContainerPtr(const ContainerBase& container)
+        : inner(ContainerOwner::of(container)) {}
 
     explicit operator bool() const {
         return inner.operator bool();
@@ -65,17 +72,17 @@ struct ContainerPtr<OwnershipKind::Shared> {
     ContainerBase* asRaw() const {
         return inner.get();
     }
-    const std::shared_ptr<ContainerBase>& asShared() const {
+    const ContainerOwner& asShared() const {
         return inner;
     }
-    std::weak_ptr<ContainerBase> asWeak() const {
+    ContainerWeakOwner asWeak() const {
         return inner;
     }
 };
 
 template <>
 struct ContainerPtr<OwnershipKind::Weak> {
-    std::weak_ptr<ContainerBase> inner{};
+    ContainerWeakOwner inner{};
 
     ContainerPtr() = default;
     ContainerPtr(const ContainerPtr&) = default;
@@ -87,19 +94,24 @@ struct ContainerPtr<OwnershipKind::Weak> {
     ContainerPtr(const ContainerPtr<OwnershipOther>& containerPtr)
         : inner(containerPtr.asWeak()) {}
 
-    ContainerPtr(std::shared_ptr<ContainerBase> container)
-        : inner(std::move(container)) {}
+    ContainerPtr(const ContainerBase* container)
+        : inner(container ? ContainerWeakOwner::of(*container) : nullptr) {}
+
+    ContainerPtr(const ContainerBase& container)
+        : inner(ContainerWeakOwner::of(container)) {}
 
     explicit operator bool() const {
         return !inner.expired();
     }
+    // note: the 'Container' isn't pinned by the returned pointer, lock the weak slice/view instead
+    // (see 'ContainerSliceWeak::withLocked') to make any number of lookups through the pinned 'Container'
     ContainerBase* asRaw() const {
         return inner.lock().get();
     }
-    std::shared_ptr<ContainerBase> asShared() const {
+    ContainerOwner asShared() const {
         return inner.lock();
     }
-    const std::weak_ptr<ContainerBase>& asWeak() const {
+    const ContainerWeakOwner& asWeak() const {
         return inner;
     }
 };
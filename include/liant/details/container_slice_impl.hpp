@@ -1,4 +1,5 @@
 #pragma once
+#include "liant/borrowed.hpp"
 #include "liant/container.hpp"
 #include "liant/details/container_ptr.hpp"
 #include "liant/details/container_slice_settings.hpp"
@@ -44,11 +45,35 @@ namespace liant::details {
 template <typename TTraits, typename TSelf>
 class ContainerSliceImpl;
 
+template <typename TInterface>
+struct ResolvedInterface {
+    TInterface* interface{};
+};
+
+// pointers to the resolved interfaces (see 'SharedOwnershipCached'/'NonOwningRefCached'), empty if not enabled
+template <bool Enabled, typename... TInterfaces>
+struct ResolvedInterfaces {};
+
+template <typename... TInterfaces>
+struct ResolvedInterfaces<true, TInterfaces...> : ResolvedInterface<TInterfaces>... {
+    template <typename TInterface>
+    TInterface* get() const {
+        return static_cast<const ResolvedInterface<TInterface>&>(*this).interface;
+    }
+
+    template <typename TInterface>
+    void set(TInterface& interface) {
+        static_cast<ResolvedInterface<TInterface>&>(*this).interface = &interface;
+    }
+};
+
 // common base class for
 // - liant::ContainerSlice (owning)
 // - liant::ContainerView (non-owning)
 // - liant::ContainerSliceLazy (owning, no automatic resolving in ctor - resolve upon request)
 // - liant::ContainerViewLazy (non-owning, no automatic resolving in ctor - resolve upon request)
+// - liant::ContainerSliceCached (owning, resolved interfaces are stored inline)
+// - liant::ContainerViewCached (non-owning, resolved interfaces are stored inline)
 template <typename TTraits, template <typename...> typename TSelf, typename... TInterfaces>
 class ContainerSliceImpl<TTraits, TSelf<TInterfaces...>>
     : public std::conditional_t<TTraits::Resolve == ResolveMode::Ctor,
@@ -58,8 +83,8 @@ class ContainerSliceImpl<TTraits, TSelf<TInterfaces...>>
     template <typename UBaseContainer, typename... UTypeMappings>
     friend class liant::Container;
 
-    // `FactoryImpl<...>` should be able to access private `ContainerSliceImpl(vtable, container)` ctor
-    template <OwnershipKind OwnershipOther, typename U>
+    // `FactoryImpl<...>` should be able to access private `ContainerSliceImpl(prototype, container)` ctor
+    template <OwnershipKind OwnershipOther, typename U, typename... UArgs>
     friend class FactoryImpl;
 
     // should be able to access private members of `ContainerSliceImpl<...>` with different specializations
@@ -67,38 +92,50 @@ class ContainerSliceImpl<TTraits, TSelf<TInterfaces...>>
     friend class ContainerSliceImpl;
 
 private:
-    template <OwnershipKind OwnershipOther>
-    ContainerSliceImpl(const ContainerSliceVTableErased& vtable, const ContainerPtr<OwnershipOther>& container)
-        : vtable(vtable)
-        , container(container) {
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor) {
-            resolveAllChecked();
-        }
+    // converting from lazy slice/view means the interfaces may be not resolved yet
+    // converting into caching slice/view means the interfaces should be cached anew
+    template <typename UTraits>
+    static constexpr bool resolvesOnConversion =
+        TTraits::Resolve == ResolveMode::Ctor && (UTraits::Resolve == ResolveMode::Lazy || TTraits::CacheResolved);
+
+    // everything the slice/view consists of except the container pointer
+    // the interfaces were already resolved (if needed) by the time the prototype is taken so 'FactoryImpl' makes new
+    // slices/views out of it without walking the interfaces again
+    struct Prototype {
+        ContainerSliceVTable<TInterfaces...> vtable;
+        [[no_unique_address]] ResolvedInterfaces<TTraits::CacheResolved, TInterfaces...> resolved;
+    };
+
+    Prototype asPrototype() const {
+        return Prototype{ vtable, resolved };
     }
 
+    template <OwnershipKind OwnershipOther>
+    ContainerSliceImpl(const Prototype& prototype, const ContainerPtr<OwnershipOther>& container)
+        : vtable(prototype.vtable)
+        , resolved(prototype.resolved)
+        , container(container) {}
+
 public:
+    // the 'std::shared_ptr' itself is neither copied nor converted (the reference is counted by the 'Container')
     template <typename UBaseContainer, typename... UTypeMappings>
     ContainerSliceImpl(const std::shared_ptr<Container<UBaseContainer, UTypeMappings...>>& container)
-        : vtable(&vtableForContainer<Container<UBaseContainer, UTypeMappings...>, TInterfaces...>)
-        , container(container) {
+        : vtable(TypeIdentity<Container<UBaseContainer, UTypeMappings...>>{})
+        , container(static_cast<const ContainerBase*>(container.get())) {
         if constexpr (TTraits::Resolve == ResolveMode::Ctor) {
-            resolveAllChecked();
-        }
-    }
-    template <typename UBaseContainer, typename... UTypeMappings>
-    ContainerSliceImpl(std::shared_ptr<Container<UBaseContainer, UTypeMappings...>>&& container)
-        : vtable(&vtableForContainer<Container<UBaseContainer, UTypeMappings...>, TInterfaces...>)
-        , container(std::move(container)) {
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor) {
-            resolveAllChecked();
+            if (container) {
+                resolveAllWith(*container);
+            }
         }
     }
+    // 'ContainerSliceCtorHook' path: the 'Container' is alive for sure so the interfaces are resolved through it directly
+    // (no locking of the weak reference, no reference count changes for views)
     template <typename UBaseContainer, typename... UTypeMappings>
     ContainerSliceImpl(const Container<UBaseContainer, UTypeMappings...>& container)
-        : vtable(&vtableForContainer<Container<UBaseContainer, UTypeMappings...>, TInterfaces...>)
-        , container(container.shared_from_this()) {
+        : vtable(TypeIdentity<Container<UBaseContainer, UTypeMappings...>>{})
+        , container(static_cast<const ContainerBase&>(container)) {
         if constexpr (TTraits::Resolve == ResolveMode::Ctor) {
-            resolveAllChecked();
+            resolveAllWith(container);
         }
     }
 
@@ -106,7 +143,7 @@ public:
     ContainerSliceImpl(const ContainerSliceImpl<UTraits, USelf<TInterfaces...>>& other)
         : vtable(other.vtable)
         , container(other.container) {
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
     }
@@ -115,7 +152,7 @@ public:
     ContainerSliceImpl(ContainerSliceImpl<UTraits, USelf<TInterfaces...>>&& other)
         : vtable(std::move(other.vtable))
         , container(std::move(other.container)) {
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
     }
@@ -123,9 +160,9 @@ public:
     template <typename UTraits, template <typename...> typename USelf, typename... UInterfaces>
         requires liant::IsSubsetOf<TypeList<TInterfaces...>, TypeList<UInterfaces...>>::value
     ContainerSliceImpl(const ContainerSliceImpl<UTraits, USelf<UInterfaces...>>& other)
-        : vtable(other.vtable.vtable, other.vtable.nestedVTables, TypeList<UInterfaces...>{})
+        : vtable(other.vtable)
         , container(other.container) {
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
     }
@@ -133,9 +170,9 @@ public:
     template <typename UTraits, template <typename...> typename USelf, typename... UInterfaces>
         requires liant::IsSubsetOf<TypeList<TInterfaces...>, TypeList<UInterfaces...>>::value
     ContainerSliceImpl(ContainerSliceImpl<UTraits, USelf<UInterfaces...>>&& other)
-        : vtable(other.vtable.vtable, other.vtable.nestedVTables, TypeList<UInterfaces...>{})
+        : vtable(other.vtable)
         , container(std::move(other.container)) {
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
     }
@@ -145,7 +182,7 @@ public:
         vtable = other.vtable;
         container = other.container;
 
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
         return *this;
@@ -156,7 +193,7 @@ public:
         vtable = std::move(other.vtable);
         container = std::move(other.container);
 
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
         return *this;
@@ -165,10 +202,10 @@ public:
     template <typename UTraits, template <typename...> typename USelf, typename... UInterfaces>
         requires liant::IsSubsetOf<TypeList<TInterfaces...>, TypeList<UInterfaces...>>::value
     ContainerSliceImpl& operator=(const ContainerSliceImpl<UTraits, USelf<UInterfaces...>>& other) {
-        vtable = ContainerSliceVTable<TInterfaces...>(other.vtable.vtable, other.vtable.nestedVTables, TypeList<UInterfaces...>{});
+        vtable = ContainerSliceVTable<TInterfaces...>(other.vtable);
         container = other.container;
 
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
         return *this;
@@ -177,10 +214,10 @@ public:
     template <typename UTraits, template <typename...> typename USelf, typename... UInterfaces>
         requires liant::IsSubsetOf<TypeList<TInterfaces...>, TypeList<UInterfaces...>>::value
     ContainerSliceImpl& operator=(ContainerSliceImpl<UTraits, USelf<UInterfaces...>>&& other) {
-        vtable = ContainerSliceVTable<TInterfaces...>(other.vtable.vtable, other.vtable.nestedVTables, TypeList<UInterfaces...>{});
+        vtable = ContainerSliceVTable<TInterfaces...>(other.vtable);
         container = std::move(other.container);
 
-        if constexpr (TTraits::Resolve == ResolveMode::Ctor && UTraits::Resolve == ResolveMode::Lazy) {
+        if constexpr (resolvesOnConversion<UTraits>) {
             resolveAllChecked();
         }
         return *this;
@@ -199,7 +236,11 @@ public:
             "Interface you're trying to find is missing from ContainerSlice<...> / "
             "ContainerView<...> (search 'liant::Print' in the compilation output for details)");
 
-        return vtable.template findRaw<TInterface>(container.asRaw());
+        if constexpr (TTraits::CacheResolved) {
+            return resolved.template get<TInterface>();
+        } else {
+            return vtable.template findRaw<TInterface>(container.asRaw());
+        }
     }
 
     // trying to find already created instance registered 'as TInterface'
@@ -220,7 +261,11 @@ public:
             "Interface you're trying to resolve is missing from ContainerSlice<...> / "
             "ContainerView<...> (search 'liant::Print' in the compilation output for details)");
 
-        return vtable.template resolveRaw<TInterface>(container.asRaw());
+        if constexpr (TTraits::CacheResolved) {
+            return *resolved.template get<TInterface>();
+        } else {
+            return vtable.template resolveRaw<TInterface>(container.asRaw());
+        }
     }
 
     // resolve an instance of type registered 'as TInterface'
@@ -233,20 +278,44 @@ public:
         return SharedRef<TInterface>(resolveRaw<TInterface>(), container.asShared());
     }
 
+    // resolve several instances registered 'as UInterfaces...' at once sharing a single reference to the 'Container'
+    // (see 'liant::SharedBundle')
+    template <typename... UInterfaces>
+    SharedBundle<UInterfaces...> resolveMany() {
+        return SharedBundle<UInterfaces...>{ container.asShared(), resolveRaw<UInterfaces>()... };
+    }
+
+    // borrow already created instance registered 'as TInterface' for the duration of the full-expression
+    // no reference counting at all (see 'liant::Borrowed'), the instance should exist (always true for non-lazy slices/views)
+    template <typename TInterface>
+        requires(TTraits::Resolve == ResolveMode::Ctor)
+    [[nodiscard]] Borrowed<TInterface> borrow() const {
+        return Borrowed<TInterface>(*findRaw<TInterface>(), *container.asRaw());
+    }
+
+    // resolve an instance of type registered 'as TInterface' and borrow it for the duration of the full-expression
+    // no reference counting at all (see 'liant::Borrowed')
+    template <typename TInterface>
+        requires(TTraits::Resolve == ResolveMode::Lazy)
+    [[nodiscard]] Borrowed<TInterface> borrow() {
+        return Borrowed<TInterface>(resolveRaw<TInterface>(), *container.asRaw());
+    }
+
     void resolveAll() {
         TypeList<TInterfaces...>::forEach([&]<typename TInterface>() { //
             resolveRaw<TInterface>();
         });
     }
 
-    template <typename U>
-    [[nodiscard]] Factory<U> makeFactory() const {
-        return Factory<U>(asSelf());
+    // 'UArgs...' are the call-time arguments of the factory (see 'Factory<U, UArgs...>::make')
+    template <typename U, typename... UArgs>
+    [[nodiscard]] Factory<U, UArgs...> makeFactory() const {
+        return Factory<U, UArgs...>(asSelf());
     }
 
-    template <typename U>
-    [[nodiscard]] FactoryView<U> makeFactoryView() const {
-        return FactoryView<U>(asSelf());
+    template <typename U, typename... UArgs>
+    [[nodiscard]] FactoryView<U, UArgs...> makeFactoryView() const {
+        return FactoryView<U, UArgs...>(asSelf());
     }
 
     template <typename U>
@@ -281,12 +350,63 @@ private:
         return this->resolveRaw();
     }
 
+    // the 'Container<...>' registering the interface (see 'Container::linkInherited')
+    template <typename TInterface>
+    VTableLink<TInterface> linkFor() const {
+        return vtable.template linkFor<TInterface>(container.asRaw());
+    }
+
+    // 'Container<...>' having this slice as its base container forwards these to the underlying container
+    ForkPin pinForFork() const {
+        return ForkPin::of(container.asRaw());
+    }
+
+    void freezeForFork() {
+        if (ContainerBase* raw = container.asRaw()) {
+            raw->freezeForFork();
+        }
+    }
+
+    void preFork() {
+        if (ContainerBase* raw = container.asRaw()) {
+            raw->preFork();
+        }
+    }
+
+    void postForkParent() {
+        if (ContainerBase* raw = container.asRaw()) {
+            raw->postForkParent();
+        }
+    }
+
+    void postForkChild() {
+        if (ContainerBase* raw = container.asRaw()) {
+            raw->postForkChild();
+        }
+    }
+
     void resolveAllChecked() {
-        if (this->container) {
-            resolveAll();
+        if constexpr (TTraits::Ownership == OwnershipKind::Weak) {
+            // lock the weak reference once for all the interfaces
+            if (const ContainerOwner owner = container.asShared()) {
+                resolveAllWith(*owner.get());
+            }
+        } else if (ContainerBase* raw = container.asRaw()) {
+            resolveAllWith(*raw);
         }
     }
 
+    void resolveAllWith(const ContainerBase& raw) {
+        ContainerBase* self = const_cast<ContainerBase*>(&raw);
+        TypeList<TInterfaces...>::forEach([&]<typename TInterface>() {
+            if constexpr (TTraits::CacheResolved) {
+                resolved.set(vtable.template resolveRaw<TInterface>(self));
+            } else {
+                vtable.template resolveRaw<TInterface>(self);
+            }
+        });
+    }
+
     const ContainerSliceImpl* operator->() const {
         return this;
     }
@@ -297,6 +417,7 @@ private:
 
 private:
     ContainerSliceVTable<TInterfaces...> vtable;
+    [[no_unique_address]] ResolvedInterfaces<TTraits::CacheResolved, TInterfaces...> resolved;
 
 protected:
     // underlying container
@@ -6,31 +6,49 @@ enum class ResolveMode { Ctor, Lazy };
 struct SharedOwnership {
     static constexpr OwnershipKind Ownership = OwnershipKind::Shared;
     static constexpr ResolveMode Resolve = ResolveMode::Ctor;
+    static constexpr bool CacheResolved = false;
 };
 
 struct NonOwningRef {
     static constexpr OwnershipKind Ownership = OwnershipKind::RawRef;
     static constexpr ResolveMode Resolve = ResolveMode::Ctor;
+    static constexpr bool CacheResolved = false;
 };
 
 struct SharedOwnershipLazy {
     static constexpr OwnershipKind Ownership = OwnershipKind::Shared;
     static constexpr ResolveMode Resolve = ResolveMode::Lazy;
+    static constexpr bool CacheResolved = false;
 };
 
 struct NonOwningRefLazy {
     static constexpr OwnershipKind Ownership = OwnershipKind::RawRef;
     static constexpr ResolveMode Resolve = ResolveMode::Lazy;
+    static constexpr bool CacheResolved = false;
 };
 
 struct WeakOwnership {
     static constexpr OwnershipKind Ownership = OwnershipKind::Weak;
     static constexpr ResolveMode Resolve = ResolveMode::Ctor;
+    static constexpr bool CacheResolved = false;
 };
 
 struct WeakOwnershipLazy {
     static constexpr OwnershipKind Ownership = OwnershipKind::Weak;
     static constexpr ResolveMode Resolve = ResolveMode::Lazy;
+    static constexpr bool CacheResolved = false;
 };
 
+// resolved on construction, pointers to the resolved interfaces are stored within the slice/view itself
+struct SharedOwnershipCached {
+    static constexpr OwnershipKind Ownership = OwnershipKind::Shared;
+    static constexpr ResolveMode Resolve = ResolveMode::Ctor;
+    static constexpr bool CacheResolved = true;
+};
+
+struct NonOwningRefCached {
+    static constexpr OwnershipKind Ownership = OwnershipKind::RawRef;
+    static constexpr ResolveMode Resolve = ResolveMode::Ctor;
+    static constexpr bool CacheResolved = true;
+};
 } // namespace liant::details
\ No newline at end of file
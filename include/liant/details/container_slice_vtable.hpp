@@ -2,11 +2,7 @@
 #include "liant/container.hpp"
 #include "liant/details/container_ptr.hpp"
 #include "liant/details/container_slice_settings.hpp"
-#include "liant/details/dynamic_array.hpp"
-
-#ifndef LIANT_MODULE
-#include <cstring>
-#endif
+#include "liant/typelist.hpp"
 
 namespace liant::details {
 
@@ -14,73 +10,49 @@ template <typename TInterface>
 struct VTableItem {
     TInterface* (*findRawErased)(ContainerBase* container);
     TInterface& (*resolveRawErased)(ContainerBase* container);
+    // the 'Container<...>' registering the interface, it may be somewhere down the base containers chain
+    VTableLink<TInterface> (*linkErased)(ContainerBase* container);
 };
 
-template <typename... TInterfaces>
-struct VTable : public VTableItem<TInterfaces>... {};
-
-template <typename TContainer, typename... TInterfaces>
-static constexpr VTable<TInterfaces...> vtableForContainer = { VTableItem<TInterfaces>{
-    [](ContainerBase* container) -> TInterfaces* {
-        return static_cast<TContainer*>(container)->template findRaw<TInterfaces>();
+// every interface of every container type has exactly one table item
+template <typename TContainer, typename TInterface>
+static constexpr VTableItem<TInterface> vtableItemForContainer = {
+    [](ContainerBase* container) -> TInterface* {
+        return static_cast<TContainer*>(container)->template findRaw<TInterface>();
     },
-    [](ContainerBase* container) -> TInterfaces& {
-        return static_cast<TContainer*>(container)->template resolveRaw<TInterfaces>();
+    [](ContainerBase* container) -> TInterface& {
+        return static_cast<TContainer*>(container)->template resolveRaw<TInterface>();
     },
-}... };
-
-using VTableErased = const void*;
-using NestedVTableErased = const void*;
-
-template <typename TInterface>
-struct NestedVTableItem {
-    auto (*atErased)(const liant::DynamicArray<NestedVTableErased>& nestedVTablesErased, std::size_t idx, VTableErased vtableErased)
-        -> const VTableItem<TInterface>*;
+    &vtableLinkOf<TContainer, TInterface>,
 };
 
-template <typename... TInterfaces>
-struct NestedVTable : public NestedVTableItem<TInterfaces>... {};
-
-template <typename TVTable, typename... TInterfaces>
-static constexpr NestedVTable<TInterfaces...> nestedVTableForVTable = { NestedVTableItem<TInterfaces>{
-    [](const liant::DynamicArray<NestedVTableErased>&, std::size_t, VTableErased vtableErased) -> const VTableItem<TInterfaces>* {
-        const auto* vtable = static_cast<const TVTable*>(vtableErased);
-        const auto* vtableItem = static_cast<const VTableItem<TInterfaces>*>(vtable);
-        return vtableItem;
-    },
-}... };
+template <typename TContainer, typename TInterface>
+const VTableItem<TInterface>* vtableItemOf() {
+    return &vtableItemForContainer<TContainer, TInterface>;
+}
 
-template <typename TNestedVTable, typename... TInterfaces>
-static constexpr NestedVTable<TInterfaces...> nestedVTableForNestedVTable = { NestedVTableItem<TInterfaces>{
-    [](const liant::DynamicArray<NestedVTableErased>& nestedVTablesErased, std::size_t idx, VTableErased vtableErased) -> const VTableItem<TInterfaces>* {
-        const NestedVTableItem<TInterfaces>* nestedVTableItem = static_cast<const TNestedVTable*>(nestedVTablesErased[idx]);
-        return nestedVTableItem->atErased(nestedVTablesErased, idx - 1, vtableErased);
-    },
-}... };
+template <typename TContainer, typename TInterface>
+VTableLink<TInterface> vtableLinkOf(ContainerBase* container) {
+    return static_cast<TContainer*>(container)->template linkTo<TInterface>();
+}
 
-struct ContainerSliceVTableErased {
-    VTableErased vtable{};
-    DynamicArray<NestedVTableErased> nestedVTables;
+template <typename TInterface>
+struct ContainerSliceVTableEntry {
+    const VTableItem<TInterface>* item{};
 };
 
+// flattened table of a slice/view: each interface maps straight to the table item of the (erased) container
+// conversion into a slice/view with fewer interfaces just picks the needed entries
+// so the lookup is a single indirect call no matter how many conversions happened
 template <typename... TInterfaces>
-struct ContainerSliceVTable : ContainerSliceVTableErased {
-    template <typename... UInterfaces>
-    explicit ContainerSliceVTable(const VTable<UInterfaces...>* vtable)
-        : ContainerSliceVTableErased{
-            .vtable = vtable,
-            .nestedVTables = { &nestedVTableForVTable<VTable<UInterfaces...>, TInterfaces...> },
-        } {}
+struct ContainerSliceVTable : ContainerSliceVTableEntry<TInterfaces>... {
+    template <typename TContainer>
+    explicit ContainerSliceVTable(TypeIdentity<TContainer>)
+        : ContainerSliceVTableEntry<TInterfaces>{ &vtableItemForContainer<TContainer, TInterfaces> }... {}
 
     template <typename... UInterfaces>
-    ContainerSliceVTable(VTableErased vtable, const DynamicArray<NestedVTableErased>& nestedVTables, TypeList<UInterfaces...>)
-        : ContainerSliceVTableErased{
-            .vtable = vtable,
-            .nestedVTables = { nestedVTables, &nestedVTableForNestedVTable<NestedVTable<UInterfaces...>, TInterfaces...> },
-        } {}
-
-    explicit ContainerSliceVTable(const ContainerSliceVTableErased& vtableErased)
-        : ContainerSliceVTableErased{ vtableErased } {}
+    explicit ContainerSliceVTable(const ContainerSliceVTable<UInterfaces...>& other)
+        : ContainerSliceVTableEntry<TInterfaces>{ other.template itemFor<TInterfaces>() }... {}
 
     ContainerSliceVTable(const ContainerSliceVTable&) = default;
     ContainerSliceVTable(ContainerSliceVTable&&) = default;
@@ -88,29 +60,23 @@ struct ContainerSliceVTable : ContainerSliceVTableErased {
     ContainerSliceVTable& operator=(ContainerSliceVTable&&) = default;
 
     template <typename TInterface>
-    TInterface* findRaw(ContainerBase* container) const {
-        const auto nestedVTablesLen = nestedVTables.size();
-
-        const auto* nestedVTable = static_cast<const NestedVTable<TInterfaces...>*>(nestedVTables[nestedVTablesLen - 1]);
-        const auto* nestedVTableItem = static_cast<const NestedVTableItem<TInterface>*>(nestedVTable);
-
-        const VTableItem<TInterface>* vtableItem = (*nestedVTableItem->atErased)(nestedVTables, nestedVTablesLen - 2, vtable);
-        TInterface* containerInterface = (*vtableItem->findRawErased)(container);
+    const VTableItem<TInterface>* itemFor() const {
+        return static_cast<const ContainerSliceVTableEntry<TInterface>&>(*this).item;
+    }
 
-        return containerInterface;
+    template <typename TInterface>
+    TInterface* findRaw(ContainerBase* container) const {
+        return (*itemFor<TInterface>()->findRawErased)(container);
     }
 
     template <typename TInterface>
     TInterface& resolveRaw(ContainerBase* container) const {
-        const auto nestedVTablesLen = nestedVTables.size();
-
-        const auto* nestedVTable = static_cast<const NestedVTable<TInterfaces...>*>(nestedVTables[nestedVTablesLen - 1]);
-        const auto* nestedVTableItem = static_cast<const NestedVTableItem<TInterface>*>(nestedVTable);
-
-        const VTableItem<TInterface>* vtableItem = (*nestedVTableItem->atErased)(nestedVTables, nestedVTablesLen - 2, vtable);
-        TInterface& containerInterface = (*vtableItem->resolveRawErased)(container);
+        return (*itemFor<TInterface>()->resolveRawErased)(container);
+    }
 
-        return containerInterface;
+    template <typename TInterface>
+    VTableLink<TInterface> linkFor(ContainerBase* container) const {
+        return (*itemFor<TInterface>()->linkErased)(container);
     }
 };
-} // namespace liant::details
\ No newline at end of file
+} // namespace liant::details
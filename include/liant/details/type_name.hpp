@@ -0,0 +1,31 @@
+#pragma once
+
+#ifndef LIANT_MODULE
+#include <string_view>
+#endif
+
+namespace liant::details {
+// human readable name of 'T' (best effort, extracted from the compiler-specific function signature)
+template <typename T>
+constexpr std::string_view typeName() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    // "... liant::details::typeName<struct Foo>(void)"
+    constexpr std::string_view signature = __FUNCSIG__;
+    constexpr std::string_view prefix = "typeName<";
+    constexpr std::string_view suffix = ">(void)";
+
+    const auto begin = signature.find(prefix) + prefix.size();
+    const auto end = signature.rfind(suffix);
+#else
+    // gcc:   "... liant::details::typeName() [with T = Foo; std::string_view = ...]"
+    // clang: "... liant::details::typeName() [T = Foo]"
+    constexpr std::string_view signature = __PRETTY_FUNCTION__;
+    constexpr std::string_view prefix = "T = ";
+
+    const auto begin = signature.find(prefix) + prefix.size();
+    const auto semicolon = signature.find(';', begin);
+    const auto end = semicolon != std::string_view::npos ? semicolon : signature.rfind(']');
+#endif
+    return signature.substr(begin, end - begin);
+}
+} // namespace liant::details
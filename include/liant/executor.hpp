@@ -0,0 +1,105 @@
+#pragma once
+#include "liant/export_macro.hpp"
+
+#ifndef LIANT_MODULE
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#endif
+
+namespace liant::details {
+// the shape of tasks liant submits to an executor: copyable nullary callable
+struct ExecutorTaskArchetype {
+    void operator()() const {}
+};
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// anything callable with a nullary task which eventually runs this task (on any thread)
+// liant doesn't ship a thread pool, plug your own one in:
+//
+// container->resolveAllParallel([&pool](auto task) { pool.post(std::move(task)); });
+template <typename TExecutor>
+concept Executor = requires(TExecutor& executor, details::ExecutorTaskArchetype task) { executor(std::move(task)); };
+
+// runs the task right away on the calling thread
+struct InlineExecutor {
+    template <std::invocable TTask>
+    void operator()(TTask&& task) const {
+        std::forward<TTask>(task)();
+    }
+};
+} // namespace liant
+
+namespace liant::details {
+// group of tasks submitted to an executor
+// 'wait' blocks until every task of the group is finished and rethrows the first exception thrown by the tasks
+class TaskGroup {
+public:
+    TaskGroup() = default;
+    // tasks which are already submitted refer to the group (e.g. if the executor has rejected some later task)
+    ~TaskGroup() {
+        std::unique_lock lock(mutex);
+        done.wait(lock, [this] { return pending == 0; });
+    }
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <Executor TExecutor, std::invocable TFn>
+    void run(TExecutor& executor, TFn fn) {
+        {
+            std::lock_guard lock(mutex);
+            ++pending;
+        }
+        try {
+            executor([this, fn = std::move(fn)]() mutable {
+                std::exception_ptr taskError;
+                try {
+                    fn();
+                } catch (...) {
+                    taskError = std::current_exception();
+                }
+                finish(std::move(taskError));
+            });
+        } catch (...) {
+            // the executor has rejected the task
+            finish({});
+            throw;
+        }
+    }
+
+    void wait() {
+        std::unique_lock lock(mutex);
+        done.wait(lock, [this] { return pending == 0; });
+
+        if (error) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+private:
+    void finish(std::exception_ptr taskError) {
+        // notify under the lock: waiter may destroy the group as soon as it observes 'pending == 0'
+        std::lock_guard lock(mutex);
+        if (taskError && !error) {
+            error = std::move(taskError);
+        }
+        if (--pending == 0) {
+            done.notify_all();
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable done;
+    std::size_t pending{};
+    std::exception_ptr error;
+};
+} // namespace liant::details
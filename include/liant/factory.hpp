@@ -1,62 +1,256 @@
 #pragma once
 #include "liant/details/container_ptr.hpp"
 #include "liant/details/container_slice_vtable.hpp"
+#include "liant/executor.hpp"
+#include "liant/object_pool.hpp"
 
 #ifndef LIANT_MODULE
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <future>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #endif
 
 namespace liant::details {
 
-template <OwnershipKind OwnershipOther, typename U>
+// 'slicePrototype' is the erased 'ContainerSliceImpl<...>::Prototype' of 'UContainerSlice' (the one the factory was made from)
+// 'UArgs...' are the call-time arguments passed to the ctor of 'U' right after the slice
+template <OwnershipKind OwnershipOther, typename U, typename... UArgs>
 struct FactoryVTable {
-    U (*make)(const ContainerSliceVTableErased& sliceVTable, const ContainerPtr<OwnershipOther>& container);
-    std::unique_ptr<U> (*makeUnique)(const ContainerSliceVTableErased& sliceVTable, const ContainerPtr<OwnershipOther>& container);
-    std::shared_ptr<U> (*makeShared)(const ContainerSliceVTableErased& sliceVTable, const ContainerPtr<OwnershipOther>& container);
+    U (*make)(const void* slicePrototype, const ContainerPtr<OwnershipOther>& container, UArgs&&... args);
+    std::unique_ptr<U> (*makeUnique)(const void* slicePrototype, const ContainerPtr<OwnershipOther>& container, UArgs&&... args);
+    std::shared_ptr<U> (*makeShared)(const void* slicePrototype, const ContainerPtr<OwnershipOther>& container, UArgs&&... args);
+    // construct 'U' in the provided 'storage'
+    U* (*makeAt)(void* storage, const void* slicePrototype, const ContainerPtr<OwnershipOther>& container, UArgs&&... args);
 };
 
-template <OwnershipKind OwnershipOther, typename U, typename UContainerSlice>
-static constexpr FactoryVTable<OwnershipOther, U> factoryVTableFor = {
-    [](const ContainerSliceVTableErased& sliceVTable, const ContainerPtr<OwnershipOther>& container) -> U {
-        return U{ UContainerSlice(sliceVTable, container) };
-    },
-    [](const ContainerSliceVTableErased& sliceVTable, const ContainerPtr<OwnershipOther>& container) -> std::unique_ptr<U> {
-        return std::make_unique<U>(UContainerSlice(sliceVTable, container));
-    },
-    [](const ContainerSliceVTableErased& sliceVTable, const ContainerPtr<OwnershipOther>& container) -> std::shared_ptr<U> {
-        return std::make_shared<U>(UContainerSlice(sliceVTable, container));
-    },
+// erased 'ContainerSliceImpl<...>::Prototype' (bunch of pointers): usual small prototypes are stored inline so the factory
+// never allocates upon construction or copying, bigger ones are kept aside (shared between the copies of the factory)
+class ErasedSlicePrototype {
+    static constexpr std::size_t InlineCapacity = 8 * sizeof(void*);
+
+public:
+    template <typename UPrototype>
+    explicit ErasedSlicePrototype(const UPrototype& prototype) {
+        static_assert(std::is_trivially_copyable_v<UPrototype>);
+
+        if constexpr (sizeof(UPrototype) <= InlineCapacity && alignof(UPrototype) <= alignof(void*)) {
+            ::new (static_cast<void*>(inlineStorage)) UPrototype(prototype);
+        } else {
+            heapStorage = std::make_shared<const UPrototype>(prototype);
+        }
+    }
+
+    const void* get() const {
+        return heapStorage ? heapStorage.get() : static_cast<const void*>(inlineStorage);
+    }
+
+private:
+    alignas(void*) std::byte inlineStorage[InlineCapacity]{};
+    std::shared_ptr<const void> heapStorage;
 };
 
-template <OwnershipKind Ownership, typename T>
+// 'TArgs...' are the call-time arguments of every 'make*' method, they are perfectly forwarded to the ctor of 'T'
+// (e.g. 'TArgs = <int, const std::string&>' means 'make(int&&, const std::string&)')
+template <OwnershipKind Ownership, typename T, typename... TArgs>
 class FactoryImpl {
 public:
-    template <typename UContainerSlice>
+    // 'slice' is resolved already (unless it is lazy) so the factory takes its prototype once and every object made
+    // by the factory gets a copy of it (the interfaces are not resolved again)
+    template <typename UContainerSlice, typename UPrototype = typename UContainerSlice::Prototype>
     explicit FactoryImpl(const UContainerSlice& slice)
-        : vtable(&factoryVTableFor<Ownership, T, UContainerSlice>)
-        , sliceVTable(slice.vtable)
-        , container(slice.container) {}
+        : vtable(&vtableFor<UContainerSlice, UPrototype>)
+        , slicePrototype(slice.asPrototype())
+        , container(slice.container) {
+        static_assert(liant::PrintConditional<std::is_constructible_v<T, UContainerSlice, TArgs&&...>, T, TArgs...>,
+            "Type made by the factory should be constructible from the slice/view it was made of followed by the factory "
+            "call-time arguments (search 'liant::Print' in the compilation output for details)");
+    }
 
     FactoryImpl(const FactoryImpl&) = default;
     FactoryImpl(FactoryImpl&&) = default;
     FactoryImpl& operator=(const FactoryImpl&) = default;
     FactoryImpl& operator=(FactoryImpl&&) = default;
 
-    [[nodiscard]] T make() const {
-        return (*vtable->make)(sliceVTable, container);
+    [[nodiscard]] T make(TArgs&&... args) const {
+        return (*vtable->make)(slicePrototype.get(), container, std::forward<TArgs>(args)...);
+    }
+
+    [[nodiscard]] std::shared_ptr<T> makeShared(TArgs&&... args) const {
+        return (*vtable->makeShared)(slicePrototype.get(), container, std::forward<TArgs>(args)...);
+    }
+
+    [[nodiscard]] std::unique_ptr<T> makeUnique(TArgs&&... args) const {
+        return (*vtable->makeUnique)(slicePrototype.get(), container, std::forward<TArgs>(args)...);
+    }
+
+    // same as 'makeUnique' but the storage of the destroyed objects is reused instead of being freed
+    // every thread keeps its own bounded free list of storage blocks for 'T' objects (shared by all the factories of 'T')
+    // an object destroyed on another thread puts its storage on the free list of that thread
+    [[nodiscard]] Pooled<T> makePooled(TArgs&&... args) const {
+        ObjectPool<T>& pool = ObjectPool<T>::local();
+        void* storage = pool.acquire();
+        try {
+            return Pooled<T>((*vtable->makeAt)(storage, slicePrototype.get(), container, std::forward<TArgs>(args)...));
+        } catch (...) {
+            pool.giveBack(storage);
+            throw;
+        }
+    }
+
+    // make 'count' objects stored contiguously (only for the factories without call-time arguments)
+    [[nodiscard]] std::vector<T> makeN(std::size_t count) const
+        requires(sizeof...(TArgs) == 0)
+    {
+        std::vector<T> objects;
+        objects.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            objects.push_back((*vtable->make)(slicePrototype.get(), container));
+        }
+        return objects;
     }
 
-    [[nodiscard]] std::shared_ptr<T> makeShared() const {
-        return (*vtable->makeShared)(sliceVTable, container);
+    // make 'count' objects stored contiguously within the memory provided by 'resource'
+    [[nodiscard]] std::pmr::vector<T> makeN(std::size_t count, std::pmr::memory_resource& resource) const
+        requires(sizeof...(TArgs) == 0)
+    {
+        std::pmr::vector<T> objects(&resource);
+        objects.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            objects.push_back((*vtable->make)(slicePrototype.get(), container));
+        }
+        return objects;
     }
 
-    [[nodiscard]] std::unique_ptr<T> makeUnique() const {
-        return (*vtable->makeUnique)(sliceVTable, container);
+    // make an object within the memory allocated from 'resource' (same as 'std::pmr::polymorphic_allocator::new_object')
+    // the caller owns the object: either 'polymorphic_allocator::delete_object' it or just release the whole arena
+    // (e.g. 'std::pmr::monotonic_buffer_resource::release') if the destructor of 'T' may be skipped
+    [[nodiscard]] T* makeInto(std::pmr::memory_resource& resource, TArgs&&... args) const {
+        void* storage = resource.allocate(sizeof(T), alignof(T));
+        try {
+            return (*vtable->makeAt)(storage, slicePrototype.get(), container, std::forward<TArgs>(args)...);
+        } catch (...) {
+            resource.deallocate(storage, sizeof(T), alignof(T));
+            throw;
+        }
     }
 
+    // same as 'makeUnique' but the object is made by a task submitted to the 'executor' (i.e. off the calling thread)
+    // call-time arguments are moved into the task, references are kept as is (make sure they outlive the task)
+    // the factory is copied into the task so 'FactoryView' requires the 'Container' to outlive the task as well
+    template <Executor TExecutor>
+    [[nodiscard]] std::future<std::unique_ptr<T>> makeAsync(TExecutor&& executor, TArgs&&... args) const {
+        struct State {
+            std::promise<std::unique_ptr<T>> promise;
+            std::tuple<TArgs...> args;
+        };
+        // tasks submitted to the executor are copyable hence the shared state
+        auto state = std::make_shared<State>(State{ {}, std::tuple<TArgs...>(std::forward<TArgs>(args)...) });
+        std::future<std::unique_ptr<T>> future = state->promise.get_future();
+
+        executor([factory = *this, state]() {
+            try {
+                state->promise.set_value(std::apply(
+                    [&](auto&... args) { return factory.makeUnique(std::forward<TArgs>(args)...); }, state->args));
+            } catch (...) {
+                state->promise.set_exception(std::current_exception());
+            }
+        });
+        return future;
+    }
+
+    // coroutine counterpart of 'makeAsync': 'co_await factory.makeOn(executor, args...)' suspends the awaiting coroutine,
+    // makes the object by a task submitted to the 'executor' and resumes the coroutine on the executor thread afterwards
+    // the awaiter may be stored and awaited later: call-time arguments are moved into it, references are kept as is
+    // (same as 'makeAsync'), the factory is copied into it and the executor is referenced unless it's a temporary
+    template <Executor TExecutor>
+    [[nodiscard]] auto makeOn(TExecutor&& executor, TArgs&&... args) const {
+        class MakeAwaiter {
+        public:
+            MakeAwaiter(const FactoryImpl& factory, TExecutor&& executor, TArgs&&... args)
+                : factory(factory)
+                , executor(std::forward<TExecutor>(executor))
+                , args(std::forward<TArgs>(args)...) {}
+
+            // the task submitted to the executor refers to the awaiter
+            MakeAwaiter(const MakeAwaiter&) = delete;
+            MakeAwaiter& operator=(const MakeAwaiter&) = delete;
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> awaiting) {
+                executor([this, awaiting]() {
+                    try {
+                        object = std::apply(
+                            [&](auto&... args) { return factory.makeUnique(std::forward<TArgs>(args)...); }, this->args);
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    awaiting.resume();
+                });
+            }
+
+            std::unique_ptr<T> await_resume() {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+                return std::move(object);
+            }
+
+        private:
+            FactoryImpl factory;
+            TExecutor executor;
+            std::tuple<TArgs...> args;
+            std::unique_ptr<T> object;
+            std::exception_ptr error;
+        };
+        return MakeAwaiter(*this, std::forward<TExecutor>(executor), std::forward<TArgs>(args)...);
+    }
+
+    // statistics of the calling thread's pool of 'T' objects (see 'makePooled')
+    [[nodiscard]] static PoolStats poolStats() {
+        return ObjectPool<T>::local().getStats();
+    }
+
+    // the maximum number of storage blocks kept on the calling thread's free list (the excess is freed right away)
+    static void setPoolCapacity(std::size_t capacity) {
+        ObjectPool<T>::local().setCapacity(capacity);
+    }
+
+private:
+    // member of 'FactoryImpl' so that it can use private 'ContainerSliceImpl(prototype, container)' ctor
+    template <typename UContainerSlice, typename UPrototype>
+    static constexpr FactoryVTable<Ownership, T, TArgs...> vtableFor = {
+        [](const void* slicePrototype, const ContainerPtr<Ownership>& container, TArgs&&... args) -> T {
+            const auto& prototype = *static_cast<const UPrototype*>(slicePrototype);
+            return T{ UContainerSlice(prototype, container), std::forward<TArgs>(args)... };
+        },
+        [](const void* slicePrototype, const ContainerPtr<Ownership>& container, TArgs&&... args) -> std::unique_ptr<T> {
+            const auto& prototype = *static_cast<const UPrototype*>(slicePrototype);
+            return std::make_unique<T>(UContainerSlice(prototype, container), std::forward<TArgs>(args)...);
+        },
+        [](const void* slicePrototype, const ContainerPtr<Ownership>& container, TArgs&&... args) -> std::shared_ptr<T> {
+            const auto& prototype = *static_cast<const UPrototype*>(slicePrototype);
+            return std::make_shared<T>(UContainerSlice(prototype, container), std::forward<TArgs>(args)...);
+        },
+        [](void* storage, const void* slicePrototype, const ContainerPtr<Ownership>& container, TArgs&&... args) -> T* {
+            const auto& prototype = *static_cast<const UPrototype*>(slicePrototype);
+            return ::new (storage) T{ UContainerSlice(prototype, container), std::forward<TArgs>(args)... };
+        },
+    };
+
 private:
-    const FactoryVTable<Ownership, T>* vtable{};
-    ContainerSliceVTableErased sliceVTable;
+    const FactoryVTable<Ownership, T, TArgs...>* vtable{};
+    ErasedSlicePrototype slicePrototype;
     ContainerPtr<Ownership> container{};
 };
 } // namespace liant::details
@@ -65,15 +259,15 @@ private:
 LIANT_EXPORT
 // clang-format on
 namespace liant {
-template <typename T>
-class Factory : public details::FactoryImpl<details::OwnershipKind::Shared, T> {
+template <typename T, typename... TArgs>
+class Factory : public details::FactoryImpl<details::OwnershipKind::Shared, T, TArgs...> {
 public:
-    using details::FactoryImpl<details::OwnershipKind::Shared, T>::FactoryImpl;
+    using details::FactoryImpl<details::OwnershipKind::Shared, T, TArgs...>::FactoryImpl;
 };
 
-template <typename T>
-class FactoryView : public details::FactoryImpl<details::OwnershipKind::RawRef, T> {
+template <typename T, typename... TArgs>
+class FactoryView : public details::FactoryImpl<details::OwnershipKind::RawRef, T, TArgs...> {
 public:
-    using details::FactoryImpl<details::OwnershipKind::RawRef, T>::FactoryImpl;
+    using details::FactoryImpl<details::OwnershipKind::RawRef, T, TArgs...>::FactoryImpl;
 };
 } // namespace liant
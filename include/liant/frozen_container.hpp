@@ -0,0 +1,79 @@
+#pragma once
+#include "liant/export_macro.hpp"
+#include "liant/ownership.hpp"
+#include "liant/ptr.hpp"
+#include "liant/typelist.hpp"
+
+#ifndef LIANT_MODULE
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// read-only snapshot of the fully resolved 'Container' (see 'Container::freeze')
+// every interface of the 'Container' (the inherited ones included) is resolved once and kept within a flat array so
+// every lookup is a single indexed load, no matter how deep the base containers chain is
+// nothing can be created or destroyed through it so it may be shared by any number of threads without any synchronization
+// the 'Container' won't be destroyed until the snapshot goes out of scope, don't tear it down (e.g. 'destroyAllParallel') meanwhile
+template <typename TContainer>
+class FrozenContainer {
+    using Interfaces = TContainer::FlatInterfaces;
+
+    template <typename UBaseContainer, typename... UTypeMappings>
+    friend class Container;
+
+    explicit FrozenContainer(TContainer& container)
+        : owner(details::ContainerOwner::of(container)) {
+        snapshot(container, Interfaces{});
+    }
+
+public:
+    template <typename TInterface>
+    [[nodiscard]] TInterface* findRaw() const {
+        return static_cast<TInterface*>(instances[indexOf<TInterface>()]);
+    }
+
+    template <typename TInterface>
+    [[nodiscard]] SharedPtr<TInterface> find() const {
+        return SharedPtr<TInterface>(resolve<TInterface>());
+    }
+
+    template <typename TInterface>
+    TInterface& resolveRaw() const {
+        return *findRaw<TInterface>();
+    }
+
+    template <typename TInterface>
+    SharedRef<TInterface> resolve() const {
+        return SharedRef<TInterface>(resolveRaw<TInterface>(), owner);
+    }
+
+private:
+    template <typename TInterface>
+    static constexpr std::size_t indexOf() {
+        constexpr std::ptrdiff_t index = Interfaces::find([]<typename UInterface>() { //
+            return std::is_same_v<UInterface, TInterface>;
+        });
+        static_assert(liant::PrintConditional<index != -1, TInterface>,
+            "You're trying to find an interface which isn't registered within the frozen DI container "
+            "(search 'liant::Print' in the compilation output for details)");
+        return static_cast<std::size_t>(index);
+    }
+
+    template <typename... TInterfaces>
+    void snapshot(TContainer& container, TypeList<TInterfaces...>) {
+        std::size_t i = 0;
+        ((instances[i++] = static_cast<void*>(&container.template resolveRaw<TInterfaces>())), ...);
+    }
+
+private:
+    std::array<void*, Interfaces::size()> instances{};
+    details::ContainerOwner owner;
+};
+} // namespace liant
@@ -1,9 +1,18 @@
 #pragma once
+#include "liant/borrowed.hpp"
 #include "liant/container.hpp"
+#include "liant/container_ref.hpp"
 #include "liant/container_slice.hpp"
 #include "liant/container_view.hpp"
+#include "liant/executor.hpp"
 #include "liant/factory.hpp"
+#include "liant/frozen_container.hpp"
+#include "liant/object_pool.hpp"
+#include "liant/ownership.hpp"
 #include "liant/dependency_macro.hpp"
 #include "liant/ptr.hpp"
+#include "liant/scoped_container.hpp"
+#include "liant/shared_bundle.hpp"
+#include "liant/task.hpp"
 #include "liant/tuple.hpp"
 #include "liant/typelist.hpp"
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+#include "liant/export_macro.hpp"
+
+#ifndef LIANT_MODULE
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// statistics of the calling thread's pool of objects of some type (see 'Factory::makePooled')
+struct PoolStats {
+    // objects made in the storage taken from the free list
+    std::size_t hits{};
+    // objects made in the newly allocated storage (the free list was empty)
+    std::size_t misses{};
+    // storage blocks put back on the free list by the destroyed objects
+    std::size_t recycled{};
+    // storage blocks freed right away by the destroyed objects (the free list was full)
+    std::size_t dropped{};
+    // storage blocks on the free list right now
+    std::size_t cached{};
+    // the upper bound of the free list length
+    std::size_t capacity{};
+};
+
+template <typename T>
+struct PoolDeleter;
+
+// object made by 'Factory::makePooled': its storage goes back on the free list of the thread destroying it
+template <typename T>
+using Pooled = std::unique_ptr<T, PoolDeleter<T>>;
+} // namespace liant
+
+namespace liant::details {
+
+// per-thread bounded free list of storage blocks for objects of type 'T'
+// the storage released on other thread just goes on the free list of that thread
+template <typename T>
+class ObjectPool {
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr std::size_t BlockSize = std::max(sizeof(T), sizeof(FreeBlock));
+    static constexpr std::align_val_t BlockAlignment{ std::max(alignof(T), alignof(FreeBlock)) };
+
+    // frees the cached blocks once the thread exits
+    // the pool itself is trivially destructible so the objects destroyed later than that (e.g. owned by other thread_local
+    // variables) may still use it: they free their storage right away (the capacity is zero by then)
+    struct Drainer {
+        ~Drainer() {
+            pool.setCapacity(0);
+        }
+        ObjectPool& pool;
+    };
+
+public:
+    static constexpr std::size_t DefaultCapacity = 64;
+
+    static ObjectPool& local() {
+        thread_local constinit ObjectPool pool;
+        thread_local Drainer drainer{ pool };
+        static_cast<void>(drainer);
+        return pool;
+    }
+
+    void* acquire() {
+        if (FreeBlock* block = head) {
+            head = block->next;
+            --stats.cached;
+            ++stats.hits;
+            return block;
+        }
+        ++stats.misses;
+        return allocate();
+    }
+
+    // storage of the destroyed object
+    void release(void* storage) noexcept {
+        if (cache(storage)) {
+            ++stats.recycled;
+        } else {
+            ++stats.dropped;
+        }
+    }
+
+    // storage which has never held an object (the object's ctor has thrown): neither recycled nor dropped
+    void giveBack(void* storage) noexcept {
+        static_cast<void>(cache(storage));
+    }
+
+    // the excess blocks are freed right away
+    void setCapacity(std::size_t capacity) noexcept {
+        stats.capacity = capacity;
+        while (stats.cached > capacity) {
+            FreeBlock* block = head;
+            head = block->next;
+            --stats.cached;
+            deallocate(block);
+        }
+    }
+
+    const PoolStats& getStats() const {
+        return stats;
+    }
+
+private:
+    // put the storage on the free list unless it's full (the storage is freed right away then)
+    bool cache(void* storage) noexcept {
+        if (stats.cached < stats.capacity) {
+            head = ::new (storage) FreeBlock{ head };
+            ++stats.cached;
+            return true;
+        }
+        deallocate(storage);
+        return false;
+    }
+
+    static void* allocate() {
+        if constexpr (static_cast<std::size_t>(BlockAlignment) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(BlockSize, BlockAlignment);
+        } else {
+            return ::operator new(BlockSize);
+        }
+    }
+
+    static void deallocate(void* storage) noexcept {
+        if constexpr (static_cast<std::size_t>(BlockAlignment) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(storage, BlockSize, BlockAlignment);
+        } else {
+            ::operator delete(storage, BlockSize);
+        }
+    }
+
+private:
+    FreeBlock* head{};
+    PoolStats stats{ .capacity = DefaultCapacity };
+};
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+template <typename T>
+struct PoolDeleter {
+    void operator()(T* object) const noexcept {
+        object->~T();
+        details::ObjectPool<T>::local().release(object);
+    }
+};
+} // namespace liant
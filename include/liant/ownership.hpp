@@ -0,0 +1,540 @@
+#pragma once
+#include "liant/export_macro.hpp"
+
+#ifndef LIANT_MODULE
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// how the 'Container' counts the references held by 'SharedRef'/'SharedPtr'/'WeakPtr' and by the owning slices
+// the counters live in the 'Container' (intrusive reference counting) no matter the policy
+// - Atomic: a single atomic counter (default)
+// - Sharded: per-thread-slot counters, each one on its own cache line, so the owners being copied and destroyed on
+//   different threads don't contend for the same cache line
+// - NonAtomic: plain counters, for the 'Container' (and everything it hands out) being used by a single thread only
+//
+// the 'std::shared_ptr' returned by 'makeContainer' is counted as a single reference no matter the policy
+// so 'std::shared_ptr::use_count' and 'std::weak_ptr' track the 'std::shared_ptr' copies only (see 'ContainerBase::useCount')
+enum class OwnershipPolicy { Atomic, Sharded, NonAtomic };
+} // namespace liant
+
+namespace liant::details {
+class RefCounts;
+class ContainerOwner;
+class ContainerWeakOwner;
+class ForkPin;
+
+template <typename TContainer, typename... TArgs>
+std::shared_ptr<TContainer> makeContainerWithPolicy(OwnershipPolicy policy, TArgs&&... args);
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+class ContainerBase : public std::enable_shared_from_this<ContainerBase> {
+    friend class details::ContainerOwner;
+    friend class details::ContainerWeakOwner;
+    friend class details::ForkPin;
+
+    template <typename TContainer, typename... TArgs>
+    friend std::shared_ptr<TContainer> details::makeContainerWithPolicy(OwnershipPolicy policy, TArgs&&... args);
+
+public:
+    virtual ~ContainerBase() = default;
+    virtual void resolveAll() = 0;
+
+    // pre-fork worker servers: the 'Container' is resolved in the master process and then shared by the forked workers
+    // through the copy-on-write pages, so nothing should write to those pages afterwards
+    // once frozen the strong references to the 'Container' (base containers included) are no longer counted: copying
+    // and destroying 'SharedRef'/'SharedPtr'/slices does no writes (the 'Container' is immortal for them)
+    // the weak references ('WeakPtr'/weak slices) are still counted, the counts are allocated apart from the 'Container'
+    // the 'Container' is only destroyed once the last 'std::shared_ptr' returned by 'makeContainer' is gone and every
+    // frozen child container having it as a base is destroyed (the frozen child pins its base container, see 'ForkPin')
+    // so keep it for as long as the 'Container' is used (usually for the whole process lifetime), irreversible
+    virtual void freezeForFork();
+
+    // 'preFork'/'postForkParent'/'postForkChild' customization points of the created items
+    // call 'preFork' right before 'fork()' and 'postForkParent'/'postForkChild' right after it in the parent/child process
+    // e.g. the items stop their threads in 'preFork' and restart them in 'postFork*' (threads don't survive 'fork()')
+    virtual void preFork() = 0;
+    virtual void postForkParent() = 0;
+    virtual void postForkChild() = 0;
+
+    bool isFrozenForFork() const;
+
+    OwnershipPolicy getOwnershipPolicy() const;
+
+    // the references held by the liant owners plus one for the 'std::shared_ptr' returned by 'makeContainer' (if any)
+    // stays as it was at the moment of freezing for the frozen 'Container' (see 'freezeForFork')
+    long useCount() const;
+
+private:
+    // set by 'makeContainer' (the 'Container' created any other way isn't counted at all)
+    details::RefCounts* refCounts{};
+};
+} // namespace liant
+
+namespace liant::details {
+
+// intrusive reference counts of the 'Container'
+// allocated separately from the 'Container' so that it outlives the 'Container' while the weak references exist
+//
+// 'Sharded' policy is a per-thread-slot counter which is "closed" once the last 'std::shared_ptr' returned by
+// 'makeContainer' is gone: every shard is folded into the central counter and from now on the owners count there
+// - until then the central counter holds a huge bias so it never drops to zero while the shards are being folded
+// - an owner may be acquired on one thread and released on other: shard counts may go negative, only the sum matters
+//
+// frozen strong counts (see 'ContainerBase::freezeForFork') are never written to again, the frozen 'Container' is kept
+// alive by 'frozenOwners' instead: the 'std::shared_ptr' returned by 'makeContainer' plus the frozen child containers
+class RefCounts {
+    static constexpr std::int64_t Bias = std::int64_t{ 1 } << 40;
+    static constexpr std::int64_t Closed = std::int64_t{ 1 } << 62;
+    // shard counts never go below -2^61 so the shard is closed if its value is above this one
+    static constexpr std::int64_t ClosedThreshold = Closed / 2;
+
+    struct alignas(64) Shard {
+        std::atomic<std::int64_t> count{};
+    };
+
+public:
+    static constexpr std::size_t ShardsCount = 32;
+
+    RefCounts(OwnershipPolicy policy, ContainerBase* container)
+        : policy(policy)
+        , container(container)
+        , strong(policy == OwnershipPolicy::Sharded ? Bias : 1)
+        , shards(policy == OwnershipPolicy::Sharded ? std::make_unique<Shard[]>(ShardsCount) : nullptr) {}
+
+    OwnershipPolicy getPolicy() const {
+        return policy;
+    }
+
+    ContainerBase* getContainer() const {
+        return container;
+    }
+
+    void freeze() noexcept {
+        frozen.store(true, std::memory_order_relaxed);
+    }
+
+    bool isFrozen() const noexcept {
+        return frozen.load(std::memory_order_relaxed);
+    }
+
+    void acquire() noexcept {
+        if (isFrozen()) {
+            return;
+        }
+        if (policy == OwnershipPolicy::NonAtomic) {
+            increment(strong);
+        } else if (policy == OwnershipPolicy::Atomic || localShard().fetch_add(1, std::memory_order_relaxed) >= ClosedThreshold) {
+            strong.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void release() noexcept {
+        if (isFrozen()) {
+            return;
+        }
+        if (policy == OwnershipPolicy::NonAtomic) {
+            if (decrement(strong) == 0) {
+                destroy();
+            }
+        } else if (policy == OwnershipPolicy::Atomic || localShard().fetch_sub(1, std::memory_order_release) >= ClosedThreshold) {
+            if (strong.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                destroy();
+            }
+        }
+    }
+
+    // acquire unless the 'Container' is destroyed already (see 'WeakPtr::lock')
+    bool tryAcquire() noexcept {
+        if (isFrozen()) {
+            return !expired();
+        }
+        if (policy == OwnershipPolicy::NonAtomic) {
+            if (strong.load(std::memory_order_relaxed) == 0) {
+                return false;
+            }
+            increment(strong);
+            return true;
+        }
+
+        // the shard is still open so this owner is going to be folded into the central counter later on
+        if (policy == OwnershipPolicy::Sharded && localShard().fetch_add(1, std::memory_order_relaxed) < ClosedThreshold) {
+            return true;
+        }
+
+        std::int64_t count = strong.load(std::memory_order_relaxed);
+        do {
+            if (count == 0) {
+                return false;
+            }
+        } while (!strong.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+        return true;
+    }
+
+    // frozen child container has this 'Container' as a base (see 'ForkPin')
+    void pin() noexcept {
+        frozenOwners.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void unpin() noexcept {
+        if (frozenOwners.fetch_sub(1, std::memory_order_acq_rel) == 1 && isFrozen()) {
+            destroy();
+        }
+    }
+
+    // the last 'std::shared_ptr' returned by 'makeContainer' is gone
+    void releaseExternal() noexcept {
+        const bool lastFrozenOwner = frozenOwners.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        if (isFrozen()) {
+            if (lastFrozenOwner) {
+                destroy();
+            }
+            return;
+        }
+        if (policy != OwnershipPolicy::Sharded) {
+            release();
+            return;
+        }
+
+        for (std::size_t i = 0; i < ShardsCount; ++i) {
+            strong.fetch_add(shards[i].count.fetch_add(Closed, std::memory_order_acq_rel), std::memory_order_relaxed);
+        }
+        if (strong.fetch_sub(Bias, std::memory_order_acq_rel) == Bias) {
+            destroy();
+        }
+    }
+
+    void acquireWeak() noexcept {
+        if (policy == OwnershipPolicy::NonAtomic) {
+            increment(weak);
+        } else {
+            weak.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void releaseWeak() noexcept {
+        const std::int64_t count = policy == OwnershipPolicy::NonAtomic ? decrement(weak)
+                                                                        : weak.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        if (count == 0) {
+            delete this;
+        }
+    }
+
+    // a single load, no read-modify-write (see 'WeakPtr::operator bool')
+    bool expired() const noexcept {
+        return destroyed.load(std::memory_order_acquire);
+    }
+
+    // the references held by the liant owners plus one for the 'std::shared_ptr' returned by 'makeContainer' (if any)
+    // approximate while the owners are being copied on other threads
+    long useCount() const noexcept {
+        std::int64_t count = strong.load(std::memory_order_relaxed);
+        if (policy == OwnershipPolicy::Sharded) {
+            for (std::size_t i = 0; i < ShardsCount; ++i) {
+                // closed shards are folded into the central counter already
+                if (const std::int64_t shardCount = shards[i].count.load(std::memory_order_relaxed); shardCount < ClosedThreshold) {
+                    count += shardCount;
+                }
+            }
+            if (count >= Bias / 2) {
+                count = count - Bias + 1;
+            }
+        }
+        return static_cast<long>(count);
+    }
+
+private:
+    // non-atomic increment/decrement for 'OwnershipPolicy::NonAtomic' (plain loads and stores, no locked instructions)
+    static void increment(std::atomic<std::int64_t>& counter) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static std::int64_t decrement(std::atomic<std::int64_t>& counter) noexcept {
+        const std::int64_t count = counter.load(std::memory_order_relaxed) - 1;
+        counter.store(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    // threads are assigned to the shards round-robin upon the first use
+    static std::size_t shardIndex() noexcept {
+        static constinit std::atomic<std::size_t> threadsCount{};
+        thread_local const std::size_t index = threadsCount.fetch_add(1, std::memory_order_relaxed) % ShardsCount;
+        return index;
+    }
+
+    std::atomic<std::int64_t>& localShard() noexcept {
+        return shards[shardIndex()].count;
+    }
+
+    void destroy() noexcept {
+        destroyed.store(true, std::memory_order_release);
+        delete container;
+        releaseWeak();
+    }
+
+private:
+    const OwnershipPolicy policy;
+    ContainerBase* const container;
+    std::atomic<bool> destroyed{};
+    // written once before the 'Container' is shared by the forked processes, only read afterwards
+    std::atomic<bool> frozen{};
+    std::atomic<std::int64_t> strong;
+    // the 'Container' itself holds one weak reference until it is destroyed
+    std::atomic<std::int64_t> weak{ 1 };
+    // the 'std::shared_ptr' returned by 'makeContainer' (until it is gone) plus the frozen child containers
+    std::atomic<std::int64_t> frozenOwners{ 1 };
+    std::unique_ptr<Shard[]> shards;
+};
+
+// strong reference to the 'Container' counted according to the 'Container' ownership policy
+// a single pointer, the reference itself is counted by 'RefCounts' of the 'Container'
+class ContainerOwner {
+    friend class ContainerWeakOwner;
+
+    struct AdoptTag {};
+
+    // takes over the reference acquired already
+    ContainerOwner(AdoptTag, ContainerBase& container)
+        : container(&container) {}
+
+public:
+    ContainerOwner() = default;
+
+    // new reference to the 'Container'
+    static ContainerOwner of(const ContainerBase& container) {
+        ContainerBase& self = const_cast<ContainerBase&>(container);
+        if (RefCounts* counts = self.refCounts) {
+            counts->acquire();
+        }
+        return ContainerOwner(AdoptTag{}, self);
+    }
+
+    ContainerOwner(std::nullptr_t) {}
+
+    ContainerOwner(const ContainerOwner& other)
+        : container(other.container) {
+        if (RefCounts* counts = refCounts()) {
+            counts->acquire();
+        }
+    }
+
+    ContainerOwner(ContainerOwner&& other) noexcept
+        : container(std::exchange(other.container, nullptr)) {}
+
+    ContainerOwner& operator=(ContainerOwner other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    ~ContainerOwner() {
+        if (RefCounts* counts = refCounts()) {
+            counts->release();
+        }
+    }
+
+    friend void swap(ContainerOwner& first, ContainerOwner& second) noexcept {
+        std::swap(first.container, second.container);
+    }
+
+    void reset() {
+        ContainerOwner tmp;
+        swap(*this, tmp);
+    }
+
+    ContainerBase* get() const {
+        return container;
+    }
+
+    ContainerBase* operator->() const {
+        return get();
+    }
+
+    explicit operator bool() const {
+        return container != nullptr;
+    }
+
+    long useCount() const {
+        return container ? container->useCount() : 0;
+    }
+
+    // 'std::shared_ptr' to the 'ptr' (owned by the 'Container') sharing the ownership of the 'Container'
+    // aliases the 'std::shared_ptr' returned by 'makeContainer' while any copy of it is alive (no allocation),
+    // otherwise a new control block holding this reference is allocated
+    // the frozen 'Container' is immortal so nothing is shared at all (the returned pointer owns nothing, no writes)
+    template <typename T>
+    std::shared_ptr<T> toStdShared(T* ptr) const {
+        if (!container) {
+            return nullptr;
+        }
+        if (container->isFrozenForFork()) {
+            return std::shared_ptr<T>(std::shared_ptr<T>(), ptr);
+        }
+        if (std::shared_ptr<ContainerBase> external = container->weak_from_this().lock()) {
+            return std::shared_ptr<T>(std::move(external), ptr);
+        }
+        return std::shared_ptr<T>(ptr, [owner = *this](T*) {});
+    }
+
+private:
+    RefCounts* refCounts() const {
+        return container ? container->refCounts : nullptr;
+    }
+
+private:
+    ContainerBase* container{};
+};
+
+// weak reference to the 'Container' counted according to the 'Container' ownership policy
+// a single pointer to 'RefCounts' of the 'Container' (outlives the 'Container' while the weak references exist)
+class ContainerWeakOwner {
+public:
+    ContainerWeakOwner() = default;
+
+    ContainerWeakOwner(const ContainerOwner& owner)
+        : counts(owner.refCounts()) {
+        if (counts) {
+            counts->acquireWeak();
+        }
+    }
+
+    ContainerWeakOwner(std::nullptr_t) {}
+
+    // new weak reference to the 'Container' (no strong reference is taken even temporarily)
+    static ContainerWeakOwner of(const ContainerBase& container) {
+        ContainerWeakOwner owner;
+        if ((owner.counts = container.refCounts)) {
+            owner.counts->acquireWeak();
+        }
+        return owner;
+    }
+
+    ContainerWeakOwner(const ContainerWeakOwner& other)
+        : counts(other.counts) {
+        if (counts) {
+            counts->acquireWeak();
+        }
+    }
+
+    ContainerWeakOwner(ContainerWeakOwner&& other) noexcept
+        : counts(std::exchange(other.counts, nullptr)) {}
+
+    ContainerWeakOwner& operator=(ContainerWeakOwner other) noexcept {
+        swap(*this, other);
+        return *this;
+    }
+
+    ~ContainerWeakOwner() {
+        if (counts) {
+            counts->releaseWeak();
+        }
+    }
+
+    friend void swap(ContainerWeakOwner& first, ContainerWeakOwner& second) noexcept {
+        std::swap(first.counts, second.counts);
+    }
+
+    void reset() {
+        ContainerWeakOwner tmp;
+        swap(*this, tmp);
+    }
+
+    ContainerOwner lock() const {
+        if (counts && counts->tryAcquire()) {
+            return ContainerOwner(ContainerOwner::AdoptTag{}, *counts->getContainer());
+        }
+        return ContainerOwner();
+    }
+
+    // the references to the 'Container' are counted at all ('false' for the scoped 'Container', see 'makeScopedContainer')
+    explicit operator bool() const {
+        return counts != nullptr;
+    }
+
+    bool expired() const {
+        return !counts || counts->expired();
+    }
+
+private:
+    RefCounts* counts{};
+};
+
+// keeps the frozen base 'Container' alive for as long as the frozen child container exists
+// counted no matter the 'Container' is frozen (the strong references to the frozen 'Container' aren't counted at all)
+class ForkPin {
+public:
+    ForkPin() = default;
+
+    static ForkPin of(const ContainerBase* container) {
+        ForkPin pin;
+        if (container && (pin.counts = container->refCounts)) {
+            pin.counts->pin();
+        }
+        return pin;
+    }
+
+    ForkPin(ForkPin&& other) noexcept
+        : counts(std::exchange(other.counts, nullptr)) {}
+
+    ForkPin& operator=(ForkPin other) noexcept {
+        std::swap(counts, other.counts);
+        return *this;
+    }
+
+    ~ForkPin() {
+        if (counts) {
+            counts->unpin();
+        }
+    }
+
+private:
+    RefCounts* counts{};
+};
+
+// the control block of the returned 'std::shared_ptr' only holds a single intrusive reference to the 'Container'
+// (released once the last 'std::shared_ptr' copy is gone)
+template <typename TContainer, typename... TArgs>
+std::shared_ptr<TContainer> makeContainerWithPolicy(OwnershipPolicy policy, TArgs&&... args) {
+    auto container = std::make_unique<TContainer>(std::forward<TArgs>(args)...);
+    container->refCounts = new RefCounts(policy, container.get());
+    return std::shared_ptr<TContainer>(container.release(), [](TContainer* container) { //
+        container->refCounts->releaseExternal();
+    });
+}
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+inline OwnershipPolicy ContainerBase::getOwnershipPolicy() const {
+    return refCounts ? refCounts->getPolicy() : OwnershipPolicy::Atomic;
+}
+
+inline void ContainerBase::freezeForFork() {
+    if (refCounts) {
+        refCounts->freeze();
+    }
+}
+
+inline bool ContainerBase::isFrozenForFork() const {
+    return refCounts && refCounts->isFrozen();
+}
+
+inline long ContainerBase::useCount() const {
+    return refCounts ? refCounts->useCount() : 0;
+}
+} // namespace liant
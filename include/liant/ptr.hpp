@@ -1,5 +1,6 @@
 #pragma once
 #include "liant/export_macro.hpp"
+#include "liant/ownership.hpp"
 
 #ifndef LIANT_MODULE
 #include <memory>
@@ -14,10 +15,9 @@ template <typename UTraits, typename USelf>
 class ContainerSliceImpl;
 } // namespace details
 
-class ContainerBase;
-
 // fat 'Dependency' shared non-null pointer
-// holds reference to the 'Dependency' from the 'Container' and shared pointer to the 'Container' itself
+// holds reference to the 'Dependency' from the 'Container' and pointer to the 'Container' itself (two pointers overall)
+// the reference is counted by the 'Container' according to its ownership policy (see 'liant::OwnershipPolicy')
 // the 'Container' won't be destroyed until all 'SharedRef's & 'SharedPtr's go out of scope
 // use with caution coz you don't really want to block the deletion of the 'Container'
 template <typename T>
@@ -28,13 +28,25 @@ class SharedRef {
     template <typename TTraits, typename USelf>
     friend class details::ContainerSliceImpl;
 
+    template <typename UContainer, typename... UInterfaces>
+    friend class ContainerRef;
+
     template <typename U>
     friend class SharedPtr;
 
     template <typename U>
     friend class WeakPtr;
 
-    SharedRef(T& ref, std::shared_ptr<const ContainerBase> owner)
+    template <typename U>
+    friend class Borrowed;
+
+    template <typename... Us>
+    friend class SharedBundle;
+
+    template <typename UContainer>
+    friend class FrozenContainer;
+
+    SharedRef(T& ref, details::ContainerOwner owner)
         : ptr(std::addressof(ref))
         , owner(std::move(owner)) {}
 
@@ -70,6 +82,12 @@ public:
         return *get();
     }
 
+    // 'std::shared_ptr' to the 'Dependency' sharing the ownership of the 'Container' (for the interop)
+    // no allocation as long as the 'std::shared_ptr' returned by 'makeContainer' (or any copy of it) is alive
+    std::shared_ptr<T> toStdShared() const {
+        return owner.toStdShared(ptr);
+    }
+
 private:
     friend bool operator==(const SharedRef& lhs, const SharedRef& rhs) {
         return lhs.ptr == rhs.ptr;
@@ -81,12 +99,13 @@ private:
 
 private:
     T* ptr{};                                     // never nullptr
-    std::shared_ptr<const ContainerBase> owner{}; // never nullptr
+    details::ContainerOwner owner{}; // never nullptr
 };
 
 
 // fat 'Dependency' shared pointer
-// holds pointer to the 'Dependency' from the 'Container' and shared pointer to the 'Container' itself
+// holds pointer to the 'Dependency' from the 'Container' and pointer to the 'Container' itself (two pointers overall)
+// the reference is counted by the 'Container' according to its ownership policy (see 'liant::OwnershipPolicy')
 // the 'Container' won't be destroyed until all 'SharedRef's & 'SharedPtr's go out of scope
 // use with caution coz you don't really want to block the deletion of the 'Container'
 template <typename T>
@@ -100,7 +119,7 @@ class SharedPtr {
     template <typename U>
     friend class WeakPtr;
 
-    SharedPtr(T* ptr, std::shared_ptr<const ContainerBase> owner)
+    SharedPtr(T* ptr, details::ContainerOwner owner)
         : ptr(ptr)
         , owner(ptr ? std::move(owner) : nullptr) {}
 
@@ -160,6 +179,11 @@ public:
         return SharedRef<T>(*ptr, owner);
     }
 
+    // see 'SharedRef::toStdShared'
+    std::shared_ptr<T> toStdShared() const {
+        return owner.toStdShared(get());
+    }
+
 private:
     friend bool operator==(const SharedPtr& lhs, const SharedPtr& rhs) {
         return lhs.ptr == rhs.ptr;
@@ -171,15 +195,15 @@ private:
 
 private:
     T* ptr{};
-    std::shared_ptr<const ContainerBase> owner{};
+    details::ContainerOwner owner{};
 };
 
 // fat 'Dependency' weak pointer
-// holds pointer to the 'Dependency' from the 'Container' and weak pointer to the 'Container' itself
-// become empty after the 'Container' goes out of scope
+// holds pointer to the 'Dependency' from the 'Container' and pointer to the reference counts of the 'Container'
+// (two pointers overall), become empty after the 'Container' goes out of scope
 template <typename T>
 class WeakPtr {
-    WeakPtr(T* ptr, std::shared_ptr<const ContainerBase> owner)
+    WeakPtr(T* ptr, details::ContainerOwner owner)
         : ptr(ptr)
         , owner(ptr ? std::move(owner) : nullptr) {}
 
@@ -219,8 +243,9 @@ public:
         owner.reset();
     }
 
+    // a single load from the reference counts of the 'Container' (no locking)
     explicit operator bool() const {
-        return owner.lock() != nullptr && ptr != nullptr;
+        return ptr != nullptr && !owner.expired();
     }
 
 private:
@@ -234,6 +259,6 @@ private:
 
 private:
     T* ptr{};
-    std::weak_ptr<const ContainerBase> owner{};
+    details::ContainerWeakOwner owner{};
 };
 } // namespace liant
\ No newline at end of file
@@ -0,0 +1,143 @@
+#pragma once
+#include "liant/container.hpp"
+#include "liant/container_slice.hpp"
+#include "liant/container_view.hpp"
+#include "liant/export_macro.hpp"
+
+#ifndef LIANT_MODULE
+#include <memory_resource>
+#include <new>
+#include <utility>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// short-lived (e.g. per incoming request) 'Container<...>' living within the provided arena (see 'makeScopedContainer')
+// the single owner of the 'Container': once gone the 'Container' is destroyed (items are destroyed in the order
+// opposite to the creation order), there is no per-item 'delete'
+// the arena belongs to the caller and it is never released by the scope (other scopes may live within the same arena),
+// release it once it has no scopes left (e.g. after every request)
+//
+// the references to the scoped 'Container' are not counted at all ('SharedRef'/'SharedPtr'/owning slices don't keep
+// it alive, 'WeakPtr' is always expired and the items can't take weak slices): nothing taken from it may outlive the scope
+template <typename TContainer>
+class ScopedContainer {
+public:
+    explicit ScopedContainer(TContainer& container)
+        : container(&container) {}
+
+    ScopedContainer(ScopedContainer&& other) noexcept
+        : container(std::exchange(other.container, nullptr)) {}
+
+    ScopedContainer& operator=(ScopedContainer&& other) noexcept {
+        ScopedContainer tmp(std::move(other));
+        swap(*this, tmp);
+        return *this;
+    }
+
+    ~ScopedContainer() {
+        if (container) {
+            container->~TContainer();
+        }
+    }
+
+    friend void swap(ScopedContainer& first, ScopedContainer& second) noexcept {
+        std::swap(first.container, second.container);
+    }
+
+    TContainer* get() const {
+        return container;
+    }
+
+    TContainer* operator->() const {
+        return container;
+    }
+
+    TContainer& operator*() const {
+        return *container;
+    }
+
+    explicit operator bool() const {
+        return container != nullptr;
+    }
+
+private:
+    TContainer* container{};
+};
+} // namespace liant
+
+namespace liant::details {
+// base container of the scoped 'Container': marks the 'Container' as scoped (see 'Container::IsScoped')
+template <typename TBaseContainer>
+class ScopedBase {
+public:
+    explicit ScopedBase(TBaseContainer baseContainer)
+        : baseContainer(std::move(baseContainer)) {}
+
+    // 'operator->' of the base container itself is applied right after this one
+    const TBaseContainer& operator->() const {
+        return baseContainer;
+    }
+
+    TBaseContainer& operator->() {
+        return baseContainer;
+    }
+
+private:
+    TBaseContainer baseContainer;
+};
+
+// every DI item of the scoped 'Container' is stored in-place, i.e. within the arena along with the 'Container' itself
+template <typename TTypeMapping>
+auto scopedItem(RegisteredItem<TTypeMapping> item) {
+    if constexpr (TTypeMapping::Lifetime == ItemLifetime::DI && TTypeMapping::Storage == ItemStorage::Heap) {
+        return std::move(item).inPlace();
+    } else {
+        return item;
+    }
+}
+
+template <typename TBaseContainer, typename... TTypeMappings>
+ScopedContainer<Container<ScopedBase<TBaseContainer>, TTypeMappings...>> makeScopedContainer(
+    std::pmr::monotonic_buffer_resource& arena, TBaseContainer baseContainer, RegisteredItem<TTypeMappings>... items) {
+    using TContainer = Container<ScopedBase<TBaseContainer>, TTypeMappings...>;
+
+    void* storage = arena.allocate(sizeof(TContainer), alignof(TContainer));
+    // note: nothing to free on failure, the arena is monotonic
+    TContainer* container = ::new (storage) TContainer(ScopedBase<TBaseContainer>(std::move(baseContainer)), items...);
+    return ScopedContainer<TContainer>(*container);
+}
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// make a short-lived 'Container' (e.g. per incoming request) within the 'arena': the 'Container' and all its DI items
+// take a single allocation from the 'arena' (the items are stored in-place, see 'RegisteredItem::inPlace'), there is
+// no 'std::shared_ptr' and no reference counts
+// e.g. per-thread 'std::pmr::monotonic_buffer_resource' over a stack buffer released by the caller after every request
+// (the scope never releases the arena itself, see 'ScopedContainer')
+template <typename... TTypeMappings>
+auto makeScopedContainer(std::pmr::monotonic_buffer_resource& arena, RegisteredItem<TTypeMappings>... items) {
+    return details::makeScopedContainer(arena, EmptyContainer{}, details::scopedItem(std::move(items))...);
+}
+
+// the base container is only referenced (the scope doesn't keep it alive), it should outlive the scope
+template <typename... TBaseTypes, typename... TTypeMappings>
+auto makeScopedContainer(
+    std::pmr::monotonic_buffer_resource& arena, const ContainerView<TBaseTypes...>& baseContainer, RegisteredItem<TTypeMappings>... items) {
+    return details::makeScopedContainer(arena, baseContainer, details::scopedItem(std::move(items))...);
+}
+
+// same as the above but the scope keeps the base container alive
+template <typename... TBaseTypes, typename... TTypeMappings>
+auto makeScopedContainer(
+    std::pmr::monotonic_buffer_resource& arena, const ContainerSlice<TBaseTypes...>& baseContainer, RegisteredItem<TTypeMappings>... items) {
+    return details::makeScopedContainer(arena, baseContainer, details::scopedItem(std::move(items))...);
+}
+} // namespace liant
@@ -0,0 +1,79 @@
+#pragma once
+#include "liant/export_macro.hpp"
+#include "liant/ownership.hpp"
+#include "liant/ptr.hpp"
+#include "liant/typelist.hpp"
+
+#ifndef LIANT_MODULE
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+namespace details {
+template <typename UTraits, typename USelf>
+class ContainerSliceImpl;
+} // namespace details
+
+// several 'Dependencies' from the 'Container' (see 'Container::resolveMany') sharing a single reference to the 'Container'
+// so it costs a single reference count increment no matter how many 'Dependencies' are there
+// the 'Container' won't be destroyed until the bundle goes out of scope
+//
+// supports structured bindings: 'auto [logger, config] = container->resolveMany<Logger, Config>();'
+template <typename... Ts>
+class SharedBundle {
+    static constexpr auto DuplicateIndex = TypeList<Ts...>::findDuplicate();
+    static_assert(DuplicateIndex == -1 || liant::Print<decltype(TypeList<Ts...>::template at<DuplicateIndex>())>,
+        "Cannot bundle same interface multiple times "
+        "(search 'liant::Print' in the compilation output for details).");
+
+    template <typename UBaseContainer, typename... UTypeMappings>
+    friend class Container;
+
+    template <typename UTraits, typename USelf>
+    friend class details::ContainerSliceImpl;
+
+    SharedBundle(details::ContainerOwner owner, Ts&... refs)
+        : ptrs{ std::addressof(refs)... }
+        , owner(std::move(owner)) {}
+
+public:
+    template <std::size_t Index>
+    auto& get() const {
+        return *std::get<Index>(ptrs);
+    }
+
+    template <typename T>
+    T& get() const {
+        static_assert(liant::PrintConditional<TypeList<Ts...>::template contains<T>(), T>,
+            "Interface you're trying to get is missing from SharedBundle<...> "
+            "(search 'liant::Print' in the compilation output for details)");
+
+        return *std::get<T*>(ptrs);
+    }
+
+    // 'SharedRef' to a single 'Dependency' from the bundle (shares the reference to the 'Container' with the bundle)
+    template <typename T>
+    SharedRef<T> toSharedRef() const {
+        return SharedRef<T>(get<T>(), owner);
+    }
+
+private:
+    std::tuple<Ts*...> ptrs;
+    details::ContainerOwner owner;
+};
+} // namespace liant
+
+template <typename... Ts>
+struct std::tuple_size<liant::SharedBundle<Ts...>> : std::integral_constant<std::size_t, sizeof...(Ts)> {};
+
+template <std::size_t Index, typename... Ts>
+struct std::tuple_element<Index, liant::SharedBundle<Ts...>> {
+    using type = std::tuple_element_t<Index, std::tuple<Ts...>>&;
+};
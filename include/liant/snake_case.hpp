@@ -11,6 +11,8 @@ inline namespace snake_case {
 
 using container_base = ContainerBase;
 
+using ownership_policy = OwnershipPolicy;
+
 template <typename TBaseContainer, typename... TTypeMappings>
 using container = Container<TBaseContainer, TTypeMappings...>;
 
@@ -32,8 +34,28 @@ using container_slice_weak = ContainerSliceWeak<TInterfaces...>;
 template <typename... TInterfaces>
 using container_slice_weak_lazy = ContainerSliceWeakLazy<TInterfaces...>;
 
+template <typename... TInterfaces>
+using container_slice_cached = ContainerSliceCached<TInterfaces...>;
+
+template <typename... TInterfaces>
+using container_view_cached = ContainerViewCached<TInterfaces...>;
+
+template <typename TContainer, typename... TInterfaces>
+using container_ref = ContainerRef<TContainer, TInterfaces...>;
+
 using empty_container = EmptyContainer;
 
+using inline_executor = InlineExecutor;
+using teardown_report = TeardownReport;
+using task = Task;
+using pool_stats = PoolStats;
+
+template <typename T>
+using pool_deleter = PoolDeleter<T>;
+
+template <typename T>
+using pooled = Pooled<T>;
+
 template <typename TTypeMapping>
 using registered_item = RegisteredItem<TTypeMapping>;
 
@@ -49,6 +71,20 @@ using shared_ptr = SharedPtr<T>;
 template <typename T>
 using weak_ptr = WeakPtr<T>;
 
+template <typename T>
+using borrowed = Borrowed<T>;
+
+using dangling_borrow_handler = DanglingBorrowHandler;
+
+template <typename... Ts>
+using shared_bundle = SharedBundle<Ts...>;
+
+template <typename TContainer>
+using scoped_container = ScopedContainer<TContainer>;
+
+template <typename TContainer>
+using frozen_container = FrozenContainer<TContainer>;
+
 
 template <typename T>
 using type_identity = TypeIdentity<T>;
@@ -68,5 +104,12 @@ using type_list_merge = TypeListMerge<TTypeLists...>;
 
 template <typename... TTypeLists>
 using type_list_merge_t = TypeListMerge<TTypeLists...>::type;
+
+
+template <typename TTypeList, typename TExcluded>
+using type_list_exclude = TypeListExclude<TTypeList, TExcluded>;
+
+template <typename TTypeList, typename TExcluded>
+using type_list_exclude_t = TypeListExclude<TTypeList, TExcluded>::type;
 } // namespace snake_case
 } // namespace liant
\ No newline at end of file
@@ -0,0 +1,217 @@
+#pragma once
+#include "liant/export_macro.hpp"
+
+#ifndef LIANT_MODULE
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+#endif
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// minimal lazy coroutine (nothing is run until it is awaited)
+// returned by 'Container::resolveAllAsync', may be awaited from any coroutine or blocked on using 'liant::syncWait'
+class [[nodiscard]] Task {
+public:
+    struct promise_type {
+        Task get_return_object() {
+            return Task{ std::coroutine_handle<promise_type>::from_promise(*this) };
+        }
+
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+
+        auto final_suspend() noexcept {
+            struct FinalAwaiter {
+                bool await_ready() noexcept {
+                    return false;
+                }
+                // resume whoever awaited this task
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> self) noexcept {
+                    return self.promise().continuation;
+                }
+                void await_resume() noexcept {}
+            };
+            return FinalAwaiter{};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            error = std::current_exception();
+        }
+
+        std::coroutine_handle<> continuation = std::noop_coroutine();
+        std::exception_ptr error;
+    };
+
+    Task(Task&& other) noexcept
+        : coro(std::exchange(other.coro, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            coro = std::exchange(other.coro, {});
+        }
+        return *this;
+    }
+    ~Task() {
+        reset();
+    }
+
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            bool await_ready() noexcept {
+                return !coro || coro.done();
+            }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                coro.promise().continuation = awaiting;
+                return coro;
+            }
+            void await_resume() {
+                if (coro && coro.promise().error) {
+                    std::rethrow_exception(coro.promise().error);
+                }
+            }
+
+            std::coroutine_handle<promise_type> coro;
+        };
+        return Awaiter{ coro };
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> coro)
+        : coro(coro) {}
+
+    void reset() {
+        if (coro) {
+            coro.destroy();
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> coro;
+};
+} // namespace liant
+
+namespace liant::details {
+// eagerly started coroutine which destroys itself once finished
+// used to run a 'Task' without awaiting it from another coroutine
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() noexcept {
+            return {};
+        }
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+};
+
+// awaits all the tasks simultaneously: every task is started right away and runs until its first suspension point,
+// the awaiting coroutine is resumed by whichever task finishes last (possibly on another thread)
+// rethrows the first exception thrown by the tasks once all of them are finished
+class WhenAll {
+public:
+    explicit WhenAll(std::vector<Task> tasks)
+        : tasks(std::move(tasks))
+        , pending(this->tasks.size() + 1) {}
+
+    bool await_ready() const noexcept {
+        return tasks.empty();
+    }
+
+    bool await_suspend(std::coroutine_handle<> awaiting) {
+        continuation = awaiting;
+        for (Task& task : tasks) {
+            run(std::move(task));
+        }
+        // the last one to finish resumes the awaiting coroutine (suspension is cancelled if all tasks are done already)
+        return pending.fetch_sub(1, std::memory_order_acq_rel) > 1;
+    }
+
+    void await_resume() {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    DetachedTask run(Task task) {
+        try {
+            co_await std::move(task);
+        } catch (...) {
+            if (!failed.exchange(true, std::memory_order_relaxed)) {
+                error = std::current_exception();
+            }
+        }
+
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            continuation.resume();
+        }
+    }
+
+private:
+    std::vector<Task> tasks;
+    std::atomic<std::size_t> pending;
+    std::atomic<bool> failed{};
+    std::exception_ptr error;
+    std::coroutine_handle<> continuation;
+};
+
+inline WhenAll whenAll(std::vector<Task> tasks) {
+    return WhenAll{ std::move(tasks) };
+}
+} // namespace liant::details
+
+// clang-format off
+LIANT_EXPORT
+// clang-format on
+namespace liant {
+
+// block the calling thread until the 'task' is finished (it may be resumed on any other thread meanwhile)
+// rethrows the exception thrown by the 'task'
+inline void syncWait(Task task) {
+    struct State {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done{};
+        std::exception_ptr error;
+    } state;
+
+    [](Task task, State& state) -> details::DetachedTask {
+        std::exception_ptr error;
+        try {
+            co_await std::move(task);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // notify under the lock: 'state' is gone as soon as the waiting thread observes 'done'
+        std::lock_guard lock(state.mutex);
+        state.error = std::move(error);
+        state.done = true;
+        state.cv.notify_one();
+    }(std::move(task), state);
+
+    std::unique_lock lock(state.mutex);
+    state.cv.wait(lock, [&] { return state.done; });
+    if (state.error) {
+        std::rethrow_exception(state.error);
+    }
+}
+} // namespace liant
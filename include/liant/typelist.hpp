@@ -22,6 +22,10 @@ struct TypeIdentity {
 
 template <typename... Ts>
 struct TypeList {
+    static constexpr std::size_t size() {
+        return sizeof...(Ts);
+    }
+
     template <typename T>
     static constexpr bool contains() {
         return (std::is_same_v<T, Ts> || ...);
@@ -114,6 +118,19 @@ struct TypeListMerge<TypeList<Ts...>, TypeList<Us...>, TTypeListsTail...> {
 
 template <typename... TTypeLists>
 using TypeListMergeT = typename TypeListMerge<TTypeLists...>::type;
+
+
+// types of 'TTypeList' which aren't contained within 'TExcluded'
+template <typename TTypeList, typename TExcluded>
+struct TypeListExclude;
+
+template <typename... Ts, typename TExcluded>
+struct TypeListExclude<TypeList<Ts...>, TExcluded> {
+    using type = TypeListMergeT<std::conditional_t<TExcluded::template contains<Ts>(), TypeList<>, TypeList<Ts>>...>;
+};
+
+template <typename TTypeList, typename TExcluded>
+using TypeListExcludeT = typename TypeListExclude<TTypeList, TExcluded>::type;
 } // namespace liant
 
 namespace liant {
@@ -1,14 +1,28 @@
 module;
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <functional>
+#include <future>
+#include <iostream>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
-#include <array>
-#include <cstddef>
-#include <type_traits>
-
 export module liant;
 #include "liant/liant.hpp"
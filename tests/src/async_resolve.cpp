@@ -0,0 +1,175 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include "thread_pool.hpp"
+#include <doctest/doctest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace liant::test {
+
+namespace {
+struct SharedStats {
+    void created(const std::string& name) {
+        std::lock_guard lock(mutex);
+        stats.creationOrder += name + " ";
+    }
+
+    std::string creationOrder() {
+        std::lock_guard lock(mutex);
+        return stats.creationOrder;
+    }
+
+    std::mutex mutex;
+    Stats stats;
+};
+
+// every 'Meeting' participant waits (for a limited time) until all the participants show up
+struct Meeting {
+    bool join(int participants) {
+        std::unique_lock lock(mutex);
+        ++arrived;
+        cv.notify_all();
+        return cv.wait_for(lock, std::chrono::seconds(5), [&] { return arrived >= participants; });
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int arrived{};
+};
+
+template <auto IdV>
+struct Leaf {
+    Leaf(SharedStats& stats, Meeting& meeting, ThreadPool& pool)
+        : stats(stats)
+        , meeting(meeting)
+        , pool(pool) {}
+
+    void postCreate() {
+        stats.created("Leaf" + std::to_string(IdV) + "(sync)");
+    }
+
+    liant::Task postCreateAsync() {
+        co_await pool.schedule();
+        metOthers = meeting.join(2);
+        stats.created("Leaf" + std::to_string(IdV));
+    }
+
+    SharedStats& stats;
+    Meeting& meeting;
+    ThreadPool& pool;
+    bool metOthers{};
+};
+
+struct Root {
+    Root(liant::ContainerView<Leaf<1>, Leaf<2>> di, SharedStats& stats)
+        : di(di)
+        , stats(stats) {}
+
+    liant::Task postCreateAsync() {
+        stats.created("Root");
+        co_return;
+    }
+
+    liant::ContainerView<Leaf<1>, Leaf<2>> di;
+    SharedStats& stats;
+};
+
+struct Counted {
+    liant::Task postCreateAsync() {
+        ++initialized;
+        co_return;
+    }
+
+    int initialized{};
+};
+
+struct Throwing {
+    liant::Task postCreateAsync() {
+        throw std::runtime_error("Throwing");
+        co_return;
+    }
+};
+
+liant::Task resolveFromCoroutine(liant::Task resolving, bool& resolved) {
+    co_await std::move(resolving);
+    resolved = true;
+}
+} // namespace
+
+TEST_CASE("should await postCreateAsync of independent items simultaneously and respect the dependencies order") {
+    SharedStats stats;
+    Meeting meeting;
+    ThreadPool pool(2);
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Root>().bindArgs(std::ref(stats)),
+        liant::registerInstanceOf<Leaf<1>>().bindArgs(std::ref(stats), std::ref(meeting), std::ref(pool)),
+        liant::registerInstanceOf<Leaf<2>>().bindArgs(std::ref(stats), std::ref(meeting), std::ref(pool))
+    );
+    // clang-format on
+    liant::syncWait(container->resolveAllAsync());
+
+    // both leafs were being initialized at the same time
+    REQUIRE(container->findRaw<Leaf<1>>()->metOthers);
+    REQUIRE(container->findRaw<Leaf<2>>()->metOthers);
+
+    // all items are created synchronously first, async initialization follows the dependencies
+    const std::string creationOrder = stats.creationOrder();
+    const bool leafsFirst = creationOrder == "Leaf1(sync) Leaf2(sync) Leaf1 Leaf2 Root " ||
+        creationOrder == "Leaf1(sync) Leaf2(sync) Leaf2 Leaf1 Root ";
+    REQUIRE(leafsFirst);
+}
+
+TEST_CASE("should initialize base container items asynchronously and only once") {
+    // clang-format off
+    auto baseContainer = liant::makeContainer(
+        liant::registerInstanceOf<Counted>()
+    );
+    auto container = liant::makeContainer(
+        liant::baseContainer(baseContainer),
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    liant::syncWait(container->resolveAllAsync());
+    liant::syncWait(container->resolveAllAsync());
+
+    REQUIRE(container->find<Trivial<1>>());
+    REQUIRE_EQ(baseContainer->findRaw<Counted>()->initialized, 1);
+}
+
+TEST_CASE("should be awaitable from other coroutines") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Counted>()
+    );
+    // clang-format on
+
+    bool resolved = false;
+    liant::syncWait(resolveFromCoroutine(container->resolveAllAsync(), resolved));
+
+    REQUIRE(resolved);
+    REQUIRE_EQ(container->findRaw<Counted>()->initialized, 1);
+}
+
+TEST_CASE("should rethrow the exception thrown by postCreateAsync") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Throwing>(),
+        liant::registerInstanceOf<Counted>()
+    );
+    // clang-format on
+
+    bool thrown = false;
+    try {
+        liant::syncWait(container->resolveAllAsync());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+    REQUIRE_EQ(container->findRaw<Counted>()->initialized, 1);
+}
+} // namespace liant::test
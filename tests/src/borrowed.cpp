@@ -0,0 +1,133 @@
+// lifetime checker of 'liant::Borrowed' is tested here as well
+#define LIANT_CHECK_BORROWS
+#include "liant/liant.hpp"
+#include <array>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace liant::test {
+
+namespace borrowed {
+struct Logger {
+    std::size_t log(std::size_t value) {
+        return lines += value;
+    }
+    std::size_t lines{};
+};
+LIANT_DEPENDENCY(Logger, logger)
+
+struct Config {
+    std::string name = "config";
+};
+LIANT_DEPENDENCY(Config, config)
+} // namespace borrowed
+using namespace borrowed;
+
+static_assert(!std::is_copy_constructible_v<liant::Borrowed<Logger>>);
+static_assert(!std::is_move_constructible_v<liant::Borrowed<Logger>>);
+
+// can only be dereferenced while being a temporary
+template <typename TBorrowed>
+concept Dereferenceable = requires {
+    std::declval<TBorrowed>()->log(1);
+    *std::declval<TBorrowed>();
+    std::declval<TBorrowed>().get();
+};
+static_assert(Dereferenceable<liant::Borrowed<Logger>&&>);
+static_assert(!Dereferenceable<liant::Borrowed<Logger>&>);
+
+TEST_CASE("should borrow dependencies through LIANT_DEPENDENCY getters without touching the reference count") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Logger>(),
+        liant::registerInstanceOf<Config>()
+    );
+    // clang-format on
+    liant::ContainerSlice<Logger, Config> slice(container);
+    const auto useCount = static_cast<std::size_t>(container->useCount());
+
+    static_assert(std::is_same_v<decltype(slice.logger()), liant::Borrowed<Logger>>);
+    REQUIRE_EQ(slice.logger()->log(static_cast<std::size_t>(container->useCount())), useCount);
+    REQUIRE_EQ((*slice.config()).name, "config");
+    REQUIRE_EQ(slice.logger().get(), container->findRaw<Logger>());
+    REQUIRE_EQ(static_cast<std::size_t>(container->useCount()), useCount);
+}
+
+TEST_CASE("should resolve dependencies borrowed through LIANT_DEPENDENCY getters of lazy slices") {
+    auto container = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    liant::ContainerViewLazy<Logger, Config> view(container);
+
+    REQUIRE_FALSE(container->findRaw<Logger>());
+    REQUIRE_EQ(view.logger()->log(2), 2);
+    REQUIRE_EQ(container->findRaw<Logger>()->lines, 2);
+}
+
+TEST_CASE("should convert borrowed dependency into SharedRef") {
+    auto container = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    liant::ContainerView<Logger, Config> view(container);
+
+    liant::SharedRef<Config> config = view.config();
+    liant::ContainerSliceWeakLazy<Config> weakContainer(container);
+    container.reset();
+
+    REQUIRE(weakContainer.lock());
+    REQUIRE_EQ(config->name, "config");
+}
+
+namespace {
+std::size_t danglingBorrows = 0;
+std::string danglingTypeName;
+} // namespace
+
+TEST_CASE("should catch borrowed dependency being used after Container is destroyed") {
+    const liant::DanglingBorrowHandler previous =
+        liant::setDanglingBorrowHandler([](std::string_view typeName) {
+            ++danglingBorrows;
+            danglingTypeName = typeName;
+        });
+
+    auto container = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    liant::ContainerView<Logger, Config> view(container);
+    {
+        // note: lifetime of the temporary is extended (the only way to keep 'Borrowed' beyond the full-expression)
+        auto&& logger = view.logger();
+        REQUIRE(std::move(logger).get());
+        REQUIRE_EQ(danglingBorrows, 0);
+
+        container.reset();
+        static_cast<void>(std::move(logger).get());
+        REQUIRE_EQ(danglingBorrows, 1);
+    }
+    // note: checked once again by the destructor of 'Borrowed'
+    REQUIRE_EQ(danglingBorrows, 2);
+    REQUIRE_NE(danglingTypeName.find("Logger"), std::string::npos);
+
+    liant::setDanglingBorrowHandler(previous);
+}
+
+TEST_CASE("should not check dependencies borrowed from scoped Container") {
+    const liant::DanglingBorrowHandler previous =
+        liant::setDanglingBorrowHandler([](std::string_view) { ++danglingBorrows; });
+    const std::size_t danglingBefore = danglingBorrows;
+
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size() };
+    {
+        // note: the references to the scoped Container are not counted so there is nothing to check against
+        auto scope = liant::makeScopedContainer(arena, liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+        liant::ContainerView<Logger, Config> view(*scope);
+
+        REQUIRE_EQ(view.logger()->log(3), 3);
+        REQUIRE_EQ((*view.config()).name, "config");
+        REQUIRE_EQ(view.logger().get(), scope->findRaw<Logger>());
+    }
+    REQUIRE_EQ(danglingBorrows, danglingBefore);
+
+    liant::setDanglingBorrowHandler(previous);
+}
+} // namespace liant::test
@@ -0,0 +1,172 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <doctest/doctest.h>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace liant::test {
+
+namespace {
+constexpr int ThreadsCount = 8;
+
+// start all the threads at (roughly) the same moment to maximize the contention
+template <typename TFn>
+void runSimultaneously(TFn fn) {
+    std::atomic<bool> go = false;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < ThreadsCount; ++i) {
+        threads.emplace_back([&go, &fn, i] {
+            while (!go.load()) {
+            }
+            fn(i);
+        });
+    }
+    go.store(true);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+template <auto IdV>
+struct Counted {
+    Counted(std::atomic<int>& alive, std::atomic<int>& created)
+        : alive(alive) {
+        ++alive;
+        ++created;
+        // widen the window for the other threads to come while the item is being created
+        std::this_thread::yield();
+    }
+    ~Counted() {
+        --alive;
+    }
+
+    void postCreate() {
+        ready = true;
+    }
+
+    std::atomic<int>& alive;
+    bool ready{};
+};
+
+template <auto IdV>
+struct User {
+    User(liant::ContainerView<Counted<1>, Counted<2>> di)
+        : di(di) {}
+
+    liant::ContainerView<Counted<1>, Counted<2>> di;
+};
+} // namespace
+
+TEST_CASE("should create an item exactly once when it is lazily resolved from multiple threads simultaneously") {
+    std::atomic<int> alive = 0;
+    std::atomic<int> created = 0;
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Counted<1>>().bindArgs(std::ref(alive), std::ref(created))
+        );
+        // clang-format on
+        liant::ContainerSliceLazy<Counted<1>> slice(container);
+
+        std::vector<Counted<1>*> resolved(ThreadsCount);
+        runSimultaneously([&](int i) {
+            liant::ContainerSliceLazy<Counted<1>> threadSlice = slice;
+            resolved[i] = &threadSlice.resolveRaw<Counted<1>>();
+        });
+
+        REQUIRE_EQ(created.load(), 1);
+        for (Counted<1>* item : resolved) {
+            REQUIRE_EQ(item, container->findRaw<Counted<1>>());
+        }
+    }
+    REQUIRE_EQ(alive.load(), 0);
+}
+
+TEST_CASE("should create shared dependencies exactly once and destroy everything when items are resolved from multiple threads") {
+    std::atomic<int> alive = 0;
+    std::atomic<int> created = 0;
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Counted<1>>().bindArgs(std::ref(alive), std::ref(created)),
+            liant::registerInstanceOf<Counted<2>>().bindArgs(std::ref(alive), std::ref(created)),
+            liant::registerInstanceOf<User<0>>(),
+            liant::registerInstanceOf<User<1>>(),
+            liant::registerInstanceOf<User<2>>(),
+            liant::registerInstanceOf<User<3>>()
+        );
+        // clang-format on
+        liant::ContainerViewLazy<User<0>, User<1>, User<2>, User<3>> view(container);
+
+        runSimultaneously([&](int i) {
+            switch (i % 4) {
+            case 0:
+                view.resolveRaw<User<0>>();
+                break;
+            case 1:
+                view.resolveRaw<User<1>>();
+                break;
+            case 2:
+                view.resolveRaw<User<2>>();
+                break;
+            default:
+                view.resolveRaw<User<3>>();
+                break;
+            }
+        });
+
+        REQUIRE_EQ(created.load(), 2);
+        REQUIRE_EQ(alive.load(), 2);
+    }
+    REQUIRE_EQ(alive.load(), 0);
+}
+
+TEST_CASE("should find either nothing or fully created item while it is being created by other thread") {
+    std::atomic<int> alive = 0;
+    std::atomic<int> created = 0;
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Counted<1>>().bindArgs(std::ref(alive), std::ref(created))
+    );
+    // clang-format on
+    liant::ContainerSliceLazy<Counted<1>> slice(container);
+
+    std::atomic<int> notReady = 0;
+    runSimultaneously([&](int i) {
+        if (i == 0) {
+            slice.resolveRaw<Counted<1>>();
+        } else {
+            Counted<1>* item = nullptr;
+            while (!(item = slice.findRaw<Counted<1>>())) {
+            }
+            if (!item->ready) {
+                ++notReady;
+            }
+        }
+    });
+
+    REQUIRE_EQ(created.load(), 1);
+    REQUIRE_EQ(notReady.load(), 0);
+}
+
+TEST_CASE("should keep per-item state apart from the items without over-aligning Container") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>().inPlace(),
+        liant::registerInstanceOf<Trivial<2>>().inPlace(),
+        liant::registerInstanceOf<Trivial<3>>()
+    );
+    // clang-format on
+    using Container = decltype(container)::element_type;
+    static_assert(alignof(Container) <= alignof(std::max_align_t));
+    static_assert(alignof(decltype(Container::RegisteredItems::at<0>())::type) <= alignof(std::max_align_t));
+
+    container->resolveAll();
+    REQUIRE_EQ(container->findRaw<Trivial<1>>()->Id, 1);
+    REQUIRE_EQ(container->findRaw<Trivial<2>>()->Id, 2);
+    REQUIRE_EQ(container->findRaw<Trivial<3>>()->Id, 3);
+}
+} // namespace liant::test
@@ -119,4 +119,36 @@ TEST_CASE(
     REQUIRE(container->find<Interface3>());
     REQUIRE(container->find<Interface4>());
 }
+
+TEST_CASE("ensure types from deep chain of base containers are found and resolved right from the leaf container") {
+    auto root = liant::makeContainer(liant::registerInstanceOf<Trivial<1>>(), liant::registerInstanceOf<Trivial<2>>());
+    auto middle = liant::makeContainer(root, liant::registerInstanceOf<Trivial<3>>());
+    auto top = liant::makeContainer(middle, liant::registerInstanceOf<Trivial<4>>());
+    // note: shadows 'Trivial<2>' of the root container
+    auto leaf = liant::makeContainer(top, liant::registerInstanceOf<Trivial<2>>().bindArgs(22));
+
+    // note: nothing is created in the base containers up until it is requested
+    REQUIRE_FALSE(leaf->findRaw<Trivial<1>>());
+    REQUIRE_FALSE(leaf->findRaw<Trivial<3>>());
+
+    REQUIRE_EQ(&leaf->resolveRaw<Trivial<1>>(), root->findRaw<Trivial<1>>());
+    REQUIRE_EQ(leaf->findRaw<Trivial<1>>(), root->findRaw<Trivial<1>>());
+    REQUIRE_EQ(leaf->resolve<Trivial<3>>().get(), middle->findRaw<Trivial<3>>());
+    REQUIRE_EQ(leaf->find<Trivial<4>>().get(), nullptr);
+    REQUIRE_EQ(leaf->resolveRaw<Trivial<2>>().Id, 22);
+    REQUIRE_EQ(top->resolveRaw<Trivial<2>>().Id, 2);
+}
+
+TEST_CASE("ensure types from base container slice in the middle of chain are found right from the leaf container") {
+    auto root = liant::makeContainer(liant::registerInstanceOf<Trivial<1>>(), liant::registerInstanceOf<Trivial<2>>());
+    auto middle = liant::makeContainer(liant::ContainerSlice<Trivial<1>>(root), liant::registerInstanceOf<Trivial<3>>());
+    auto leaf = liant::makeContainer(middle, liant::registerInstanceOf<Trivial<4>>());
+
+    // note: 'ContainerSlice' resolves its types right away
+    REQUIRE(root->findRaw<Trivial<1>>());
+    REQUIRE_FALSE(root->findRaw<Trivial<2>>());
+    REQUIRE_EQ(leaf->findRaw<Trivial<1>>(), root->findRaw<Trivial<1>>());
+    REQUIRE_EQ(&leaf->resolveRaw<Trivial<1>>(), root->findRaw<Trivial<1>>());
+    REQUIRE_EQ(leaf->resolve<Trivial<3>>().get(), middle->findRaw<Trivial<3>>());
+}
 } // namespace liant::test
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <doctest/doctest.h>
+#include <string>
+#include <type_traits>
+
+namespace liant::test {
+
+namespace concrete {
+struct Logger {
+    virtual ~Logger() = default;
+    virtual std::string name() const = 0;
+};
+
+struct ConsoleLogger final : Logger {
+    std::string name() const override {
+        return "console";
+    }
+};
+
+struct Config {
+    int value = 42;
+};
+
+struct Service {
+    Service(liant::ContainerView<Logger> di)
+        : di(di) {}
+
+    liant::ContainerView<Logger> di;
+};
+} // namespace concrete
+using namespace concrete;
+
+TEST_CASE("should resolve the registered concrete type behind an interface") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ConsoleLogger>().as<Logger>(),
+        liant::registerInstanceOf<Service>()
+    );
+    // clang-format on
+    REQUIRE_FALSE(container->find<Logger>());
+
+    auto& logger = container->resolveConcrete<Logger>();
+    static_assert(std::is_same_v<decltype(logger), ConsoleLogger&>);
+
+    REQUIRE_EQ(&logger, container->findRaw<Logger>());
+    REQUIRE_EQ(logger.name(), "console");
+
+    // dependencies are resolved as usual
+    auto& service = container->resolveConcrete<Service>();
+    REQUIRE_EQ(service.di.findRaw<Logger>(), &logger);
+}
+
+TEST_CASE("should resolve the registered concrete type from the base Container") {
+    auto baseContainer = liant::makeContainer(liant::registerInstanceOf<ConsoleLogger>().as<Logger>());
+    auto container = liant::makeContainer(baseContainer, liant::registerInstanceOf<Config>());
+
+    auto& logger = container->resolveConcrete<Logger>();
+    static_assert(std::is_same_v<decltype(logger), ConsoleLogger&>);
+
+    REQUIRE_EQ(&logger, baseContainer->findRaw<Logger>());
+}
+
+TEST_CASE("should resolve all interfaces of ContainerRef upon the construction") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ConsoleLogger>().as<Logger>(),
+        liant::registerInstanceOf<Config>()
+    );
+    // clang-format on
+    using TContainer = decltype(container)::element_type;
+    liant::ContainerRef<TContainer, Logger, Config> ref(container);
+
+    static_assert(std::is_same_v<decltype(ref.resolveRaw<Logger>()), ConsoleLogger&>);
+    static_assert(std::is_same_v<decltype(ref.findRaw<Config>()), Config*>);
+
+    REQUIRE_EQ(ref.findRaw<Logger>(), container->findRaw<Logger>());
+    REQUIRE_EQ(ref.findRaw<Config>(), container->findRaw<Config>());
+    REQUIRE_EQ(ref.resolveRaw<Logger>().name(), "console");
+    REQUIRE_EQ(ref.resolve<Config>()->value, 42);
+}
+
+TEST_CASE("should keep Container alive while SharedRef from ContainerRef exists") {
+    auto container = liant::makeContainer(liant::registerInstanceOf<ConsoleLogger>().as<Logger>());
+    liant::ContainerRef<decltype(container)::element_type, Logger> ref(*container);
+
+    liant::SharedRef<ConsoleLogger> logger = ref.resolve<Logger>();
+    liant::ContainerSliceWeakLazy<Logger> weakContainer(container);
+    container.reset();
+
+    REQUIRE(weakContainer.lock());
+    REQUIRE_EQ(logger->name(), "console");
+}
+} // namespace liant::test
@@ -1,6 +1,7 @@
 #include "data.hpp"
 #include "liant/liant.hpp"
 #include <doctest/doctest.h>
+#include <chrono>
 
 /*
 TrivialType1
@@ -123,4 +124,31 @@ TEST_CASE(
     REQUIRE(container->find<Interface3>());
     REQUIRE(container->find<Interface4>());
 }
+
+TEST_CASE("ensure items found through base container slice are never stale, no matter how deep the chain is") {
+    // clang-format off
+    auto sliceContainer = liant::makeContainer(
+        liant::registerInstanceOf<TrivialType1>(),
+        liant::registerInstanceOf<DerivedType1>().as<Interface1>()
+    );
+    auto container = liant::makeContainer(
+        liant::baseContainer(liant::ContainerSlice<TrivialType1, Interface1>(sliceContainer)),
+        liant::registerInstanceOf<TrivialType2>()
+    );
+    auto childContainer = liant::makeContainer(
+        liant::baseContainer(container),
+        liant::registerInstanceOf<TrivialType34>()
+    );
+    // clang-format on
+    REQUIRE_EQ(container->findRaw<Interface1>(), sliceContainer->findRaw<Interface1>());
+    REQUIRE_EQ(childContainer->findRaw<TrivialType1>(), sliceContainer->findRaw<TrivialType1>());
+
+    // note: the items behind the slice are gone while the slice itself is still there
+    sliceContainer->destroyAllParallel(liant::InlineExecutor{}, std::chrono::seconds(1));
+
+    REQUIRE_FALSE(container->findRaw<TrivialType1>());
+    REQUIRE_FALSE(container->findRaw<Interface1>());
+    REQUIRE_FALSE(childContainer->findRaw<TrivialType1>());
+    REQUIRE_FALSE(childContainer->findRaw<Interface1>());
+}
 } // namespace liant::test
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "data.hpp"
 #include "liant/liant.hpp"
 #include <doctest/doctest.h>
+#include <functional>
 
 namespace liant::test {
 
@@ -33,7 +34,7 @@ TEST_CASE("should construct ContainerSlice from same type ContainerSlice") {
     liant::ContainerSlice<S1, S2, S3, S4> slice(container);
     liant::ContainerSlice<S1, S2, S3, S4> slice2(slice);
 
-    REQUIRE_EQ(container.use_count(), 3);
+    REQUIRE_EQ(container->useCount(), 3);
 
     REQUIRE_EQ(slice2.find<S1>()->i, 1);
     REQUIRE_EQ(slice2.find<S2>()->i, 2);
@@ -59,7 +60,7 @@ TEST_CASE("should construct ContainerSlice from ContainerSlice with wider interf
     liant::ContainerSlice<S1, S2, S3, S4> slice(container);
     liant::ContainerSlice<S1, S2> slice2(slice);
 
-    REQUIRE_EQ(container.use_count(), 3);
+    REQUIRE_EQ(container->useCount(), 3);
 
     REQUIRE_EQ(slice2.find<S1>()->i, 1);
     REQUIRE_EQ(slice2.find<S2>()->i, 2);
@@ -84,7 +85,7 @@ TEST_CASE("should construct ContainerSlice from Container with wider interface")
 
     liant::ContainerSlice<S1, S2> slice(container);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     REQUIRE_EQ(slice.find<S1>()->i, 1);
     REQUIRE_EQ(slice.find<S2>()->i, 2);
@@ -108,7 +109,7 @@ TEST_CASE("should construct ContainerView from ContainerView") {
     liant::ContainerView<S1, S2, S3, S4> view(container);
     liant::ContainerView<S1, S2, S3, S4> view2(view);
 
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     REQUIRE_EQ(view2.find<S1>()->i, 1);
     REQUIRE_EQ(view2.find<S2>()->i, 2);
@@ -135,7 +136,7 @@ TEST_CASE("should construct ContainerView from ContainerView with wider interfac
     liant::ContainerView<S1, S2, S3, S4> view(container);
     liant::ContainerView<S1, S2> view2(view);
 
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     REQUIRE_EQ(view2.find<S1>()->i, 1);
     REQUIRE_EQ(view2.find<S2>()->i, 2);
@@ -159,7 +160,7 @@ TEST_CASE("should construct ContainerView from Container with wider interface")
 
     liant::ContainerView<S1, S2> view(container);
 
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     REQUIRE_EQ(view.find<S1>()->i, 1);
     REQUIRE_EQ(view.find<S2>()->i, 2);
@@ -183,7 +184,7 @@ TEST_CASE("should construct ContainerView from ContainerSlice with wider interfa
     liant::ContainerSlice<S1, S2, S3, S4> slice(container);
     liant::ContainerView<S1, S2> view(slice);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     REQUIRE_EQ(view.find<S1>()->i, 1);
     REQUIRE_EQ(view.find<S2>()->i, 2);
@@ -208,7 +209,7 @@ TEST_CASE("should construct ContainerSlice from ContainerView with wider interfa
     liant::ContainerView<S1, S2, S3, S4> view(container);
     liant::ContainerSlice<S2, S1> slice(view);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     REQUIRE_EQ(slice.find<S1>()->i, 1);
     REQUIRE_EQ(slice.find<S2>()->i, 2);
@@ -231,11 +232,11 @@ TEST_CASE("ensure ContainerSlice assign to itself ain't broken") {
     // clang-format on
 
     liant::ContainerSlice<S1, S2, S3> slice(container);
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     auto& other = slice;
     slice = other;
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     REQUIRE_EQ(container->find<S1>()->i, 1);
     REQUIRE_EQ(container->find<S2>()->i, 2);
@@ -257,10 +258,10 @@ TEST_CASE("should construct ContainerSliceWeak from ContainerSlice with wider in
     liant::ContainerSlice<S1, S2, S3, S4> slice(container);
     liant::ContainerSliceWeak<S2, S1> sliceWeak(slice);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     liant::ContainerSlice<S2, S1> slice2 = sliceWeak.lock();
-    REQUIRE_EQ(container.use_count(), 3);
+    REQUIRE_EQ(container->useCount(), 3);
 
     REQUIRE_EQ(container->find<S1>()->i, 1);
     REQUIRE_EQ(container->find<S2>()->i, 2);
@@ -281,10 +282,10 @@ TEST_CASE("should construct ContainerSliceWeakLazy from ContainerSliceLazy with
     liant::ContainerSliceLazy<S1, S2, S3, S4> slice(container);
     liant::ContainerSliceWeakLazy<S2, S1> sliceWeak(slice);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     liant::ContainerSliceLazy<S2, S1> slice2 = sliceWeak.lock();
-    REQUIRE_EQ(container.use_count(), 3);
+    REQUIRE_EQ(container->useCount(), 3);
 
     REQUIRE_FALSE(container->find<S1>());
     REQUIRE_FALSE(container->find<S2>());
@@ -299,6 +300,39 @@ TEST_CASE("should construct ContainerSliceWeakLazy from ContainerSliceLazy with
     REQUIRE_FALSE(container->find<S4>());
 }
 
+TEST_CASE("should pin Container for the whole withLocked scope of ContainerSliceWeak") {
+    Stats stats;
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<S1>(),
+        liant::registerInstanceOf<S2>(),
+        liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats))
+    );
+    // clang-format on
+    liant::ContainerSliceWeak<S1, S2, Trackable<1>> sliceWeak(container);
+    liant::ContainerSliceWeakLazy<S1> sliceWeakLazy(container);
+
+    const bool called = sliceWeak.withLocked([&](liant::ContainerSlice<S1, S2, Trackable<1>>& slice) {
+        REQUIRE_EQ(container->useCount(), 2);
+        container.reset();
+
+        // note: the 'Container' is kept alive until the end of the scope
+        REQUIRE_EQ(stats.destroyingOrder, "");
+        REQUIRE_EQ(slice.findRaw<S1>()->i, 1);
+        REQUIRE_EQ(slice.resolveRaw<S2>().i, 2);
+        REQUIRE_EQ(slice.useCount(), 1);
+    });
+    REQUIRE(called);
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+
+    // note: the 'Container' is gone so the scope isn't entered at all
+    int calls = 0;
+    REQUIRE_FALSE(sliceWeak.withLocked([&](auto&) { ++calls; }));
+    REQUIRE_FALSE(sliceWeakLazy.withLocked([&](auto&) { ++calls; }));
+    REQUIRE_EQ(calls, 0);
+}
+
 TEST_CASE("Ensure multiple layers of indirection work") {
     // clang-format off
     auto container = liant::makeContainer(
@@ -314,13 +348,38 @@ TEST_CASE("Ensure multiple layers of indirection work") {
     liant::ContainerSliceLazy<S3, S4> slice3(slice2);
     liant::ContainerSliceLazy<S4> slice4(slice3);
 
-    REQUIRE_EQ(container.use_count(), 5);
+    REQUIRE_EQ(container->useCount(), 5);
 
     slice4.resolve<S4>();
 
     REQUIRE_EQ(slice4.find<S4>()->i, 4);
 }
 
+TEST_CASE("should keep interfaces mapping through reordering subset conversions") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<S1>(),
+        liant::registerInstanceOf<S2>(),
+        liant::registerInstanceOf<S3>(),
+        liant::registerInstanceOf<S4>()
+    );
+    // clang-format on
+
+    liant::ContainerViewLazy<S1, S2, S3, S4> view1(container);
+    liant::ContainerViewLazy<S4, S2, S3> view2(view1);
+    liant::ContainerSliceLazy<S3, S4> slice3(view2);
+    liant::ContainerView<S4, S3> view4(slice3);
+    liant::ContainerViewLazy<S3> view5(view1);
+    view5 = view4;
+
+    REQUIRE_EQ(view4.findRaw<S3>()->i, 3);
+    REQUIRE_EQ(view4.findRaw<S4>()->i, 4);
+    REQUIRE_EQ(view5.findRaw<S3>(), container->findRaw<S3>());
+    REQUIRE_EQ(view2.findRaw<S4>(), container->findRaw<S4>());
+    REQUIRE_FALSE(view2.findRaw<S2>());
+    REQUIRE_EQ(view2.resolveRaw<S2>().i, 2);
+}
+
 TEST_CASE("should construct ContainerSlice from ContainerViewLazy (same interfaces)") {
     auto container = liant::makeContainer(liant::registerInstanceOf<S1>(), liant::registerInstanceOf<S2>());
 
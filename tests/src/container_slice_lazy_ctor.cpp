@@ -33,7 +33,7 @@ TEST_CASE("should construct ContainerSliceLazy from same type ContainerSliceLazy
     liant::ContainerSliceLazy<S1, S2, S3, S4> slice(container);
     liant::ContainerSliceLazy<S1, S2, S3, S4> slice2(slice);
 
-    REQUIRE_EQ(container.use_count(), 3);
+    REQUIRE_EQ(container->useCount(), 3);
 
     slice2.resolve<S2>();
     slice2.resolve<S3>();
@@ -62,7 +62,7 @@ TEST_CASE("should construct ContainerSliceLazy from ContainerSliceLazy with wide
     liant::ContainerSliceLazy<S1, S2, S3, S4> slice(container);
     liant::ContainerSliceLazy<S1, S2> slice2(slice);
 
-    REQUIRE_EQ(container.use_count(), 3);
+    REQUIRE_EQ(container->useCount(), 3);
 
     slice2.resolve<S2>();
 
@@ -87,7 +87,7 @@ TEST_CASE("should construct ContainerSliceLazy from Container with wider interfa
 
     liant::ContainerSliceLazy<S1, S2> slice(container);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     REQUIRE_FALSE(slice.find<S1>());
     REQUIRE_FALSE(slice.find<S2>());
@@ -116,7 +116,7 @@ TEST_CASE("should construct ContainerViewLazy from ContainerViewLazy") {
     liant::ContainerViewLazy<S1, S2, S3, S4> view(container);
     liant::ContainerViewLazy<S1, S2, S3, S4> view2(view);
 
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     view2.resolve<S2>();
     view2.resolve<S3>();
@@ -145,7 +145,7 @@ TEST_CASE("should construct ContainerViewLazy from ContainerViewLazy with wider
     liant::ContainerViewLazy<S1, S2, S3, S4> view(container);
     liant::ContainerViewLazy<S1, S2> view2(view);
 
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     view2.resolve<S1>();
 
@@ -170,7 +170,7 @@ TEST_CASE("should construct ContainerViewLazy from Container with wider interfac
 
     liant::ContainerViewLazy<S1, S2> view(container);
 
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     view.resolve<S1>();
 
@@ -196,7 +196,7 @@ TEST_CASE("should construct ContainerViewLazy from ContainerSlice with wider int
     liant::ContainerSliceLazy<S1, S2, S3, S4> slice(container);
     liant::ContainerViewLazy<S1, S2> view(slice);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     view.resolve<S1>();
 
@@ -222,7 +222,7 @@ TEST_CASE("should construct ContainerSliceLazy from ContainerViewLazy with wider
     liant::ContainerViewLazy<S1, S2, S3, S4> view(container);
     liant::ContainerSliceLazy<S2, S1> slice(view);
 
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     view.resolve<S1>();
 
@@ -252,8 +252,8 @@ TEST_CASE("ensure ContainerSliceLazy assignment indeed assign different containe
     liant::ContainerSliceLazy<S1, S2> slice1(container1);
     liant::ContainerSliceLazy<S1, S2, S3> slice2(container2);
 
-    REQUIRE_EQ(container1.use_count(), 2);
-    REQUIRE_EQ(container2.use_count(), 2);
+    REQUIRE_EQ(container1->useCount(), 2);
+    REQUIRE_EQ(container2->useCount(), 2);
     REQUIRE_EQ(slice1.useCount(), 2);
     REQUIRE_EQ(slice2.useCount(), 2);
 
@@ -267,8 +267,8 @@ TEST_CASE("ensure ContainerSliceLazy assignment indeed assign different containe
 
     slice1 = slice2;
 
-    REQUIRE_EQ(container1.use_count(), 1);
-    REQUIRE_EQ(container2.use_count(), 3);
+    REQUIRE_EQ(container1->useCount(), 1);
+    REQUIRE_EQ(container2->useCount(), 3);
     REQUIRE_EQ(slice1.useCount(), 3);
     REQUIRE_EQ(slice2.useCount(), 3);
 
@@ -290,14 +290,14 @@ TEST_CASE("should construct ContainerSlice from ContainerViewLazy with wider int
     // clang-format on
 
     liant::ContainerViewLazy<S1, S2, S3> view(container);
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
     REQUIRE_FALSE(container->find<S1>());
     REQUIRE_FALSE(container->find<S2>());
     REQUIRE_FALSE(container->find<S3>());
     REQUIRE_FALSE(container->find<S4>());
 
     liant::ContainerSlice<S2, S1> slice(view);
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
     REQUIRE_EQ(container->find<S1>()->i, 1);
     REQUIRE_EQ(container->find<S2>()->i, 2);
     REQUIRE_FALSE(container->find<S3>());
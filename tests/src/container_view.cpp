@@ -296,7 +296,7 @@ TEST_CASE("ensure empty liant::SharedPtr doesn't keep container alive") {
     );
     // clang-format on
 
-    std::weak_ptr weakContainer(container);
+    liant::ContainerSliceWeakLazy<Trackable<1>, Trackable<2>> weakContainer(container);
 
     REQUIRE_EQ(stats.destroyingOrder, "");
 
@@ -309,7 +309,7 @@ TEST_CASE("ensure empty liant::SharedPtr doesn't keep container alive") {
     container.reset();
 
     // note: container is destroyed!
-    REQUIRE(weakContainer.expired());
+    REQUIRE_FALSE(weakContainer.lock());
     REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
 }
 
@@ -324,7 +324,7 @@ TEST_CASE("ensure non-empty liant::SharedPtr keeps container alive") {
     );
     // clang-format on
 
-    std::weak_ptr weakContainer(container);
+    liant::ContainerSliceWeakLazy<Trackable<1>, Trackable<2>> weakContainer(container);
 
     REQUIRE_EQ(stats.destroyingOrder, "");
 
@@ -337,14 +337,14 @@ TEST_CASE("ensure non-empty liant::SharedPtr keeps container alive") {
     container.reset();
 
     // note: container is still alive!
-    REQUIRE(!weakContainer.expired());
+    REQUIRE(weakContainer.lock());
     REQUIRE_EQ(stats.destroyingOrder, "");
-    REQUIRE(weakContainer.lock()->findRaw<Trackable<1>>());
+    REQUIRE(weakContainer.lock().findRaw<Trackable<1>>());
 
     sharedPtr.reset();
 
     // note: container is finally destroyed
-    REQUIRE(weakContainer.expired());
+    REQUIRE_FALSE(weakContainer.lock());
 }
 
 TEST_CASE("ensure liant::SharedRef (never empty) keeps container alive") {
@@ -358,7 +358,7 @@ TEST_CASE("ensure liant::SharedRef (never empty) keeps container alive") {
     );
     // clang-format on
 
-    std::weak_ptr weakContainer(container);
+    liant::ContainerSliceWeakLazy<Trackable<1>, Trackable<2>> weakContainer(container);
 
     REQUIRE_EQ(stats.destroyingOrder, "");
 
@@ -368,14 +368,14 @@ TEST_CASE("ensure liant::SharedRef (never empty) keeps container alive") {
         container.reset();
 
         // note: container is still alive!
-        REQUIRE(!weakContainer.expired());
+        REQUIRE(weakContainer.lock());
         REQUIRE_EQ(stats.destroyingOrder, "");
-        REQUIRE(weakContainer.lock()->findRaw<Trackable<1>>());
+        REQUIRE(weakContainer.lock().findRaw<Trackable<1>>());
     }
     // note: sharedRef goes out of scope
 
     // note: container is finally destroyed
-    REQUIRE(weakContainer.expired());
+    REQUIRE_FALSE(weakContainer.lock());
 }
 
 TEST_CASE("should be able to create liant::ContainerView from liant::ContainerSlice") {
@@ -417,11 +417,11 @@ TEST_CASE("should be able to create liant::ContainerSlice from liant::ContainerV
     // Interface1/Interface2/Type3 will be resolved automatically (liant::ContainerView ctor will do that)
     liant::ContainerView<Interface1, Interface2, Type3> containerView(container);
     // ContainerView ain't holding a strong pointer to container
-    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 1);
 
     const liant::ContainerSlice<Interface1, Interface2, Type3> containerSlice(containerView);
     // ContainerSlice DO hold a strong pointer to container
-    REQUIRE_EQ(container.use_count(), 2);
+    REQUIRE_EQ(container->useCount(), 2);
 
     Interface1* interface1 = containerView.findRaw<Interface1>();
     Interface2& interface2 = containerView.Interface2_PrettyGetterRaw();
@@ -0,0 +1,131 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <doctest/doctest.h>
+#include <string>
+
+namespace liant::test {
+
+namespace cached {
+struct Logger {
+    virtual ~Logger() = default;
+    virtual std::string name() const = 0;
+};
+LIANT_DEPENDENCY(Logger, logger)
+
+struct ConsoleLogger : Logger {
+    std::string name() const override {
+        return "console";
+    }
+};
+
+struct Config {
+    int value = 42;
+};
+
+struct Service {
+    Service(liant::ContainerViewCached<Logger, Config> di)
+        : di(di) {}
+
+    liant::ContainerViewCached<Logger, Config> di;
+};
+
+struct Product {
+    liant::ContainerViewCached<Config> di;
+};
+} // namespace cached
+using namespace cached;
+
+TEST_CASE("should resolve all interfaces of ContainerViewCached upon the construction") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ConsoleLogger>().as<Logger>(),
+        liant::registerInstanceOf<Config>()
+    );
+    // clang-format on
+    liant::ContainerViewCached<Logger, Config> view(container);
+
+    REQUIRE(container->find<Logger>());
+    REQUIRE(container->find<Config>());
+    REQUIRE_EQ(view.findRaw<Logger>(), container->findRaw<Logger>());
+    REQUIRE_EQ(&view.resolveRaw<Config>(), container->findRaw<Config>());
+    REQUIRE_EQ(view.find<Config>()->value, 42);
+    REQUIRE_EQ(view.logger()->name(), "console");
+    REQUIRE_EQ(view.loggerRaw().name(), "console");
+}
+
+TEST_CASE("should inject ContainerViewCached into the registered types") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ConsoleLogger>().as<Logger>(),
+        liant::registerInstanceOf<Config>(),
+        liant::registerInstanceOf<Service>()
+    );
+    // clang-format on
+    Service& service = container->resolveRaw<Service>();
+
+    REQUIRE_EQ(service.di.findRaw<Logger>(), container->findRaw<Logger>());
+    REQUIRE_EQ(service.di.findRaw<Config>(), container->findRaw<Config>());
+}
+
+TEST_CASE("should cache interfaces anew upon the conversions") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ConsoleLogger>().as<Logger>(),
+        liant::registerInstanceOf<Config>()
+    );
+    // clang-format on
+    liant::ContainerViewLazy<Logger, Config> lazyView(container);
+    REQUIRE_FALSE(container->find<Config>());
+
+    // lazy view isn't resolved yet so it will be resolved here
+    liant::ContainerViewCached<Config, Logger> view(lazyView);
+    REQUIRE_EQ(view.findRaw<Config>(), container->findRaw<Config>());
+
+    liant::ContainerViewCached<Config> subset(view);
+    REQUIRE_EQ(subset.findRaw<Config>(), container->findRaw<Config>());
+
+    liant::ContainerView<Logger> plainView(view);
+    REQUIRE_EQ(plainView.findRaw<Logger>(), container->findRaw<Logger>());
+
+    liant::ContainerViewCached<Config> assigned(subset);
+    assigned = liant::ContainerView<Config>(container);
+    REQUIRE_EQ(assigned.findRaw<Config>(), container->findRaw<Config>());
+}
+
+TEST_CASE("should make objects depending on ContainerViewCached using a factory") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ConsoleLogger>().as<Logger>(),
+        liant::registerInstanceOf<Config>()
+    );
+    // clang-format on
+    liant::ContainerViewCached<Logger, Config> view(container);
+
+    Product product = view.makeFactoryView<Product>().make();
+    REQUIRE_EQ(product.di.findRaw<Config>(), container->findRaw<Config>());
+}
+
+TEST_CASE("should extend container lifetime using ContainerSliceCached") {
+    Stats stats;
+    {
+        liant::ContainerSliceCached<Trackable<1>> slice = [&] {
+            // clang-format off
+            auto container = liant::makeContainer(
+                liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats))
+            );
+            // clang-format on
+            return liant::ContainerSliceCached<Trackable<1>>(container);
+        }();
+
+        REQUIRE(slice);
+        REQUIRE_EQ(slice.useCount(), 1);
+        REQUIRE_EQ(stats.creationOrder, "Trackable1 ");
+
+        liant::ContainerSliceCached<Trackable<1>> copy = slice;
+        REQUIRE_EQ(slice.useCount(), 2);
+        REQUIRE_EQ(copy.findRaw<Trackable<1>>(), slice.findRaw<Trackable<1>>());
+        REQUIRE_EQ(stats.destroyingOrder, "");
+    }
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+}
+} // namespace liant::test
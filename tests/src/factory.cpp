@@ -0,0 +1,355 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include "thread_pool.hpp"
+#include <doctest/doctest.h>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace liant::test {
+
+namespace factory {
+struct Product {
+    liant::ContainerView<Trivial<1>, Interface<2>> di;
+};
+
+struct LazyProduct {
+    liant::ContainerViewLazy<Trivial<1>, Interface<2>> di;
+};
+
+struct Session {
+    Session(liant::ContainerView<Trivial<1>> di, int connectionId, std::string payload)
+        : di(di)
+        , connectionId(connectionId)
+        , payload(std::move(payload)) {}
+
+    liant::ContainerView<Trivial<1>> di;
+    int connectionId;
+    std::string payload;
+};
+
+struct Request {
+    liant::ContainerView<Trivial<1>> di;
+    const std::string& payload;
+};
+
+struct Parser {
+    Parser(liant::ContainerView<Trivial<1>> di, std::string grammar)
+        : di(di)
+        , grammar(std::move(grammar)) {
+        if (this->grammar.empty()) {
+            throw std::runtime_error("empty grammar");
+        }
+    }
+
+    liant::ContainerView<Trivial<1>> di;
+    std::string grammar;
+    std::thread::id madeOn = std::this_thread::get_id();
+};
+
+liant::Task makeParser(liant::Factory<Parser, std::string>& factory,
+    ThreadPool& pool,
+    std::string grammar,
+    std::unique_ptr<Parser>& parser) {
+    parser = co_await factory.makeOn(pool, std::move(grammar));
+}
+
+// neither the factory nor the call-time arguments outlive the awaiter
+auto makeParserLater(liant::ContainerView<Trivial<1>> view, ThreadPool& pool) {
+    liant::Factory<Parser, std::string> factory = view.makeFactory<Parser, std::string>();
+    std::string grammar = "yaml";
+    return factory.makeOn(pool, std::move(grammar));
+}
+
+liant::Task awaitParser(liant::ContainerView<Trivial<1>> view, ThreadPool& pool, std::unique_ptr<Parser>& parser) {
+    auto awaiter = makeParserLater(view, pool);
+    parser = co_await awaiter;
+}
+} // namespace factory
+using namespace factory;
+
+TEST_CASE("should make objects out of the resolved prototype view") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::ContainerView<Trivial<1>, Interface<2>> view(container);
+
+    liant::FactoryView<Product> factoryView = view.makeFactoryView<Product>();
+    liant::Factory<Product> factory = view.makeFactory<Product>();
+
+    Product product = factoryView.make();
+    std::unique_ptr<Product> uniqueProduct = factoryView.makeUnique();
+    std::shared_ptr<Product> sharedProduct = factory.makeShared();
+
+    REQUIRE_EQ(product.di.findRaw<Trivial<1>>(), container->findRaw<Trivial<1>>());
+    REQUIRE_EQ(uniqueProduct->di.findRaw<Interface<2>>(), container->findRaw<Interface<2>>());
+    REQUIRE_EQ(sharedProduct->di.findRaw<Interface<2>>()->getId(), 2);
+}
+
+TEST_CASE("should not resolve interfaces of objects made by the factory out of lazy view") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::ContainerViewLazy<Trivial<1>, Interface<2>> view(container);
+
+    LazyProduct product = view.makeFactoryView<LazyProduct>().make();
+    REQUIRE_FALSE(container->find<Trivial<1>>());
+    REQUIRE_FALSE(container->find<Interface<2>>());
+
+    REQUIRE_EQ(product.di.resolveRaw<Interface<2>>().getId(), 2);
+    REQUIRE(container->find<Interface<2>>());
+    REQUIRE_FALSE(container->find<Trivial<1>>());
+}
+
+TEST_CASE("should keep Container alive while Factory exists") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::Factory<Product> factory = liant::ContainerView<Trivial<1>, Interface<2>>(container).makeFactory<Product>();
+
+    liant::ContainerSliceWeakLazy<Trivial<1>> weakContainer(container);
+    container.reset();
+    REQUIRE(weakContainer.lock());
+
+    Product product = factory.make();
+    REQUIRE_EQ(product.di.findRaw<Trivial<1>>()->Id, 1);
+}
+
+TEST_CASE("should reuse the storage of destroyed pooled objects") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::FactoryView<Product> factory = liant::ContainerView<Trivial<1>, Interface<2>>(container).makeFactoryView<Product>();
+    const liant::PoolStats before = factory.poolStats();
+
+    liant::Pooled<Product> product = factory.makePooled();
+    REQUIRE_EQ(product->di.findRaw<Trivial<1>>()->Id, 1);
+    const Product* address = product.get();
+    product.reset();
+
+    liant::Pooled<Product> otherProduct = factory.makePooled();
+    REQUIRE_EQ(otherProduct.get(), address);
+    REQUIRE_EQ(otherProduct->di.findRaw<Interface<2>>()->getId(), 2);
+
+    const liant::PoolStats after = factory.poolStats();
+    REQUIRE_EQ(after.misses - before.misses, 1);
+    REQUIRE_EQ(after.hits - before.hits, 1);
+    REQUIRE_EQ(after.recycled - before.recycled, 1);
+}
+
+TEST_CASE("should not count the storage of the pooled object failed to be made as recycled") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    liant::Factory<Parser, std::string> factory = liant::ContainerView<Trivial<1>>(container).makeFactory<Parser, std::string>();
+    const liant::PoolStats before = factory.poolStats();
+
+    bool thrown = false;
+    try {
+        liant::Pooled<Parser> parser = factory.makePooled("");
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+
+    const liant::PoolStats after = factory.poolStats();
+    REQUIRE_EQ(after.recycled - before.recycled, 0);
+    REQUIRE_EQ(after.dropped - before.dropped, 0);
+    REQUIRE_EQ(after.cached - before.cached, 1);
+
+    liant::Pooled<Parser> parser = factory.makePooled("json");
+    REQUIRE_EQ(parser->grammar, "json");
+    REQUIRE_EQ(factory.poolStats().hits - before.hits, 1);
+}
+
+TEST_CASE("should keep at most 'capacity' free storage blocks per thread") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::Factory<Product> factory = liant::ContainerView<Trivial<1>, Interface<2>>(container).makeFactory<Product>();
+    const liant::PoolStats before = factory.poolStats();
+    liant::Factory<Product>::setPoolCapacity(2);
+    {
+        liant::Pooled<Product> products[] = { factory.makePooled(), factory.makePooled(), factory.makePooled() };
+    }
+    const liant::PoolStats after = factory.poolStats();
+    REQUIRE_EQ(after.capacity, 2);
+    REQUIRE_EQ(after.cached, 2);
+    REQUIRE_EQ(after.dropped - before.dropped, 1);
+
+    liant::Factory<Product>::setPoolCapacity(0);
+    REQUIRE_EQ(factory.poolStats().cached, 0);
+    liant::Factory<Product>::setPoolCapacity(before.capacity);
+}
+
+TEST_CASE("should make a batch of objects stored contiguously") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::FactoryView<Product> factory = liant::ContainerView<Trivial<1>, Interface<2>>(container).makeFactoryView<Product>();
+
+    std::vector<Product> products = factory.makeN(10);
+    REQUIRE_EQ(products.size(), 10);
+    for (const Product& product : products) {
+        REQUIRE_EQ(product.di.findRaw<Interface<2>>(), container->findRaw<Interface<2>>());
+    }
+
+    std::byte buffer[1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    std::pmr::vector<Product> arenaProducts = factory.makeN(5, arena);
+    REQUIRE_EQ(arenaProducts.size(), 5);
+    REQUIRE_EQ(arenaProducts.get_allocator().resource(), &arena);
+    REQUIRE_EQ(arenaProducts.back().di.findRaw<Trivial<1>>()->Id, 1);
+}
+
+TEST_CASE("should make objects within the provided memory resource") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>(),
+        liant::registerInstanceOf<TrivialDerived<2>>().as<Interface<2>>()
+    );
+    // clang-format on
+    liant::Factory<Product> factory = liant::ContainerView<Trivial<1>, Interface<2>>(container).makeFactory<Product>();
+
+    alignas(Product) std::byte buffer[4 * sizeof(Product)];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+
+    Product* first = factory.makeInto(arena);
+    Product* second = factory.makeInto(arena);
+    REQUIRE(reinterpret_cast<std::byte*>(first) >= buffer);
+    REQUIRE(reinterpret_cast<std::byte*>(second) < buffer + sizeof(buffer));
+    REQUIRE_EQ(first->di.findRaw<Trivial<1>>(), second->di.findRaw<Trivial<1>>());
+    REQUIRE_EQ(second->di.findRaw<Interface<2>>()->getId(), 2);
+
+    std::pmr::polymorphic_allocator<>(&arena).delete_object(second);
+    std::pmr::polymorphic_allocator<>(&arena).delete_object(first);
+}
+
+TEST_CASE("should forward call-time arguments to the objects made by the factory") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    liant::ContainerView<Trivial<1>> view(container);
+    liant::Factory<Session, int, std::string> factory = view.makeFactory<Session, int, std::string>();
+
+    Session session = factory.make(7, "payload");
+    REQUIRE_EQ(session.connectionId, 7);
+    REQUIRE_EQ(session.payload, "payload");
+    REQUIRE_EQ(session.di.findRaw<Trivial<1>>(), container->findRaw<Trivial<1>>());
+
+    std::string payload = "moved";
+    std::unique_ptr<Session> uniqueSession = factory.makeUnique(8, std::move(payload));
+    REQUIRE_EQ(uniqueSession->connectionId, 8);
+    REQUIRE_EQ(uniqueSession->payload, "moved");
+
+    REQUIRE_EQ(factory.makeShared(9, "shared")->connectionId, 9);
+    REQUIRE_EQ(factory.makePooled(10, "pooled")->payload, "pooled");
+}
+
+TEST_CASE("should pass lvalue references through the factory without copies") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    liant::FactoryView<Request, const std::string&> factory =
+        liant::ContainerView<Trivial<1>>(container).makeFactoryView<Request, const std::string&>();
+
+    const std::string payload = "payload";
+    Request request = factory.make(payload);
+    REQUIRE_EQ(&request.payload, &payload);
+}
+
+TEST_CASE("should make objects on the executor and return them through the future") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    ThreadPool pool(2);
+    liant::Factory<Parser, std::string> factory = liant::ContainerView<Trivial<1>>(container).makeFactory<Parser, std::string>();
+
+    std::future<std::unique_ptr<Parser>> parser = factory.makeAsync(pool, "json");
+    std::future<std::unique_ptr<Parser>> failedParser = factory.makeAsync(pool, "");
+
+    std::unique_ptr<Parser> madeParser = parser.get();
+    REQUIRE_EQ(madeParser->grammar, "json");
+    REQUIRE_NE(madeParser->madeOn, std::this_thread::get_id());
+    REQUIRE_EQ(madeParser->di.findRaw<Trivial<1>>(), container->findRaw<Trivial<1>>());
+
+    bool thrown = false;
+    try {
+        static_cast<void>(failedParser.get());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+}
+
+TEST_CASE("should make objects on the executor while the awaiting coroutine is suspended") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    ThreadPool pool(2);
+    liant::Factory<Parser, std::string> factory = liant::ContainerView<Trivial<1>>(container).makeFactory<Parser, std::string>();
+
+    std::unique_ptr<Parser> parser;
+    liant::syncWait(makeParser(factory, pool, "xml", parser));
+    REQUIRE_EQ(parser->grammar, "xml");
+    REQUIRE_NE(parser->madeOn, std::this_thread::get_id());
+
+    std::unique_ptr<Parser> failedParser;
+    bool thrown = false;
+    try {
+        liant::syncWait(makeParser(factory, pool, "", failedParser));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+    REQUIRE_FALSE(failedParser);
+}
+
+TEST_CASE("should keep the factory and the call-time arguments within the stored awaiter") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    ThreadPool pool(2);
+
+    std::unique_ptr<Parser> parser;
+    liant::syncWait(awaitParser(liant::ContainerView<Trivial<1>>(container), pool, parser));
+    REQUIRE_EQ(parser->grammar, "yaml");
+    REQUIRE_EQ(parser->di.findRaw<Trivial<1>>()->Id, 1);
+}
+} // namespace liant::test
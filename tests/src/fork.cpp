@@ -0,0 +1,210 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <doctest/doctest.h>
+#include <functional>
+#include <memory>
+#include <string>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/wait.h>)
+#include <sys/wait.h>
+#include <unistd.h>
+#define LIANT_TEST_HAS_FORK
+#endif
+
+namespace liant::test {
+
+namespace forking {
+struct Journal {
+    std::string events;
+};
+
+template <auto IdV>
+struct Worker {
+    void preFork() {
+        journal.events += "preFork" + std::to_string(IdV) + " ";
+    }
+    void postForkParent() {
+        journal.events += "postForkParent" + std::to_string(IdV) + " ";
+    }
+    void postForkChild() {
+        journal.events += "postForkChild" + std::to_string(IdV) + " ";
+    }
+    Journal& journal;
+};
+
+struct Service {
+    Service(liant::ContainerView<Worker<1>> di, Journal& journal)
+        : di(di)
+        , journal(journal) {}
+
+    void preFork() {
+        journal.events += "preForkService ";
+    }
+    void postForkChild() {
+        journal.events += "postForkChildService ";
+    }
+
+    liant::ContainerView<Worker<1>> di;
+    Journal& journal;
+};
+
+struct Logger {
+    int value = 42;
+};
+} // namespace forking
+using namespace forking;
+
+TEST_CASE("should stop counting references to Container once frozen for fork") {
+    for (auto policy : { liant::OwnershipPolicy::Atomic, liant::OwnershipPolicy::Sharded, liant::OwnershipPolicy::NonAtomic }) {
+        Stats stats;
+
+        auto baseContainer = liant::makeContainer(policy, liant::registerInstanceOf<Logger>());
+        auto container = liant::makeContainer(policy, baseContainer, //
+            liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)));
+        container->resolveAll();
+
+        REQUIRE_FALSE(container->isFrozenForFork());
+        container->freezeForFork();
+        REQUIRE(container->isFrozenForFork());
+        // note: base containers are frozen as well
+        REQUIRE(baseContainer->isFrozenForFork());
+
+        const long useCount = container->useCount();
+        const long baseUseCount = baseContainer->useCount();
+
+        WeakPtr<Trackable<1>> weakPtr = container->find<Trackable<1>>();
+        {
+            SharedRef<Trackable<1>> sharedRef = container->resolve<Trackable<1>>();
+            SharedPtr<Logger> logger = container->find<Logger>();
+            liant::ContainerSlice<Logger> slice(container);
+            liant::ContainerSliceWeak<Trackable<1>> weakSlice(container);
+            SharedRef<Trackable<1>> copy = sharedRef;
+
+            REQUIRE_EQ(container->useCount(), useCount);
+            REQUIRE_EQ(baseContainer->useCount(), baseUseCount);
+            REQUIRE(weakPtr.lock());
+            REQUIRE(weakSlice.lock());
+            REQUIRE_EQ(slice.resolveRaw<Logger>().value, 42);
+
+            // note: nothing is shared with the 'std::shared_ptr' returned by 'makeContainer'
+            std::shared_ptr<Trackable<1>> stdShared = copy.toStdShared();
+            REQUIRE_EQ(stdShared.get(), &*sharedRef);
+            REQUIRE_EQ(stdShared.use_count(), 0);
+            REQUIRE_EQ(container.use_count(), 1);
+        }
+        REQUIRE_EQ(container->useCount(), useCount);
+        REQUIRE_EQ(stats.destroyingOrder, "");
+
+        // note: only the 'std::shared_ptr' returned by 'makeContainer' keeps the frozen 'Container' alive
+        container.reset();
+        REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+        REQUIRE_FALSE(weakPtr);
+        REQUIRE_FALSE(weakPtr.lock());
+    }
+}
+
+TEST_CASE("should freeze ContainerSlice base container of frozen Container") {
+    auto baseContainer = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto container = liant::makeContainer(liant::ContainerSlice<Logger>(baseContainer));
+    container->resolveAll();
+
+    container->freezeForFork();
+    REQUIRE(container->isFrozenForFork());
+    REQUIRE(baseContainer->isFrozenForFork());
+}
+
+TEST_CASE("should keep base containers of frozen Container alive until the Container is destroyed") {
+    for (auto policy : { liant::OwnershipPolicy::Atomic, liant::OwnershipPolicy::Sharded, liant::OwnershipPolicy::NonAtomic }) {
+        Stats stats;
+
+        auto baseContainer = liant::makeContainer(policy, liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)));
+        // note: owned by nothing but the base slice of 'container' from the start
+        auto container = liant::makeContainer(policy,
+            liant::ContainerSlice<Trackable<2>>(liant::makeContainer(policy, //
+                liant::registerInstanceOf<Trackable<2>>().bindArgs(std::ref(stats)))),
+            liant::registerInstanceOf<Logger>());
+        auto childContainer = liant::makeContainer(policy, liant::ContainerSlice<Trackable<1>>(baseContainer));
+        container->resolveAll();
+        childContainer->resolveAll();
+
+        container->freezeForFork();
+        childContainer->freezeForFork();
+        baseContainer.reset();
+
+        REQUIRE_EQ(stats.destroyingOrder, "");
+        REQUIRE_EQ(childContainer->findRaw<Trackable<1>>()->stats.creationOrder, stats.creationOrder);
+        REQUIRE_EQ(&container->resolveRaw<Trackable<2>>().stats, &stats);
+
+        childContainer.reset();
+        REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+        container.reset();
+        REQUIRE_EQ(stats.destroyingOrder, "Trackable1 Trackable2 ");
+    }
+}
+
+TEST_CASE("should notify created items about fork in dependencies order") {
+    Journal journal;
+
+    auto baseContainer = liant::makeContainer(liant::registerInstanceOf<Worker<1>>().bindArgs(std::ref(journal)));
+    // clang-format off
+    auto container = liant::makeContainer(baseContainer,
+        liant::registerInstanceOf<Service>().bindArgs(std::ref(journal)),
+        liant::registerInstanceOf<Worker<2>>().bindArgs(std::ref(journal)),
+        liant::registerInstanceOf<Worker<3>>().bindArgs(std::ref(journal))
+    );
+    // clang-format on
+    container->resolveRaw<Worker<2>>();
+    container->resolveRaw<Service>();
+
+    container->preFork();
+    REQUIRE_EQ(journal.events, "preForkService preFork2 preFork1 ");
+
+    journal.events.clear();
+    container->postForkParent();
+    REQUIRE_EQ(journal.events, "postForkParent1 postForkParent2 ");
+
+    journal.events.clear();
+    container->postForkChild();
+    REQUIRE_EQ(journal.events, "postForkChild1 postForkChild2 postForkChildService ");
+}
+
+#ifdef LIANT_TEST_HAS_FORK
+TEST_CASE("should use frozen Container in forked child process") {
+    Journal journal;
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Logger>(),
+        liant::registerInstanceOf<Worker<1>>().bindArgs(std::ref(journal))
+    );
+    // clang-format on
+    container->resolveAll();
+    container->freezeForFork();
+
+    container->preFork();
+    const pid_t pid = ::fork();
+    REQUIRE_NE(pid, -1);
+
+    if (pid == 0) {
+        container->postForkChild();
+
+        bool ok = journal.events == "preFork1 postForkChild1 ";
+        SharedRef<Logger> logger = container->resolve<Logger>();
+        for (int i = 0; i < 1000; ++i) {
+            SharedRef<Logger> copy = logger;
+            ok = ok && copy->value == 42;
+        }
+        // note: leave the child without running the parent's destructors and doctest reporting
+        ::_exit(ok ? 0 : 1);
+    }
+
+    container->postForkParent();
+    REQUIRE_EQ(journal.events, "preFork1 postForkParent1 ");
+
+    int status{};
+    REQUIRE_EQ(::waitpid(pid, &status, 0), pid);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE_EQ(WEXITSTATUS(status), 0);
+}
+#endif
+} // namespace liant::test
@@ -0,0 +1,125 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <doctest/doctest.h>
+#include <functional>
+#include <type_traits>
+
+namespace liant::test {
+
+namespace frozen {
+struct Logger {
+    int value = 1;
+};
+
+struct Config {
+    int value = 2;
+};
+
+struct Service {
+    int value = 3;
+};
+
+struct Override : Logger {
+    Override() {
+        value = 4;
+    }
+};
+
+// anything that may create or destroy the items
+template <typename TContainer>
+concept MutableContainer = requires(TContainer& container) { container.resolveAll(); } ||
+                           requires(TContainer& container) { container.template resolveRaw<Logger>(1); } ||
+                           requires(TContainer& container) {
+                               container.destroyAllParallel(liant::InlineExecutor{}, std::chrono::seconds(1));
+                           };
+} // namespace frozen
+using namespace frozen;
+
+TEST_CASE("should resolve own and inherited interfaces of frozen Container") {
+    auto rootContainer = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto sliceBase = liant::makeContainer(liant::registerInstanceOf<Config>());
+    auto baseContainer = liant::makeContainer(rootContainer, liant::registerInstanceOf<Service>());
+    auto container = liant::makeContainer(liant::ContainerSlice<Config>(sliceBase), liant::registerInstanceOf<Trivial<1>>());
+    auto shadowing = liant::makeContainer(baseContainer, liant::registerInstanceOf<Override>().as<Logger>());
+
+    using Flat = decltype(shadowing)::element_type::FlatInterfaces;
+    static_assert(std::is_same_v<Flat, TypeList<Logger, Service>>);
+
+    auto frozen = container->freeze();
+    auto frozenShadowing = shadowing->freeze();
+
+    // note: 'freeze' resolves everything first
+    REQUIRE(container->findRaw<Trivial<1>>());
+    REQUIRE_EQ(frozen.findRaw<Config>(), sliceBase->findRaw<Config>());
+    REQUIRE_EQ(frozen.findRaw<Trivial<1>>(), container->findRaw<Trivial<1>>());
+    REQUIRE_EQ(&frozen.resolveRaw<Config>(), sliceBase->findRaw<Config>());
+    REQUIRE_EQ(frozen.resolve<Trivial<1>>().get(), container->findRaw<Trivial<1>>());
+
+    // note: shadowed interface of the base container isn't there
+    REQUIRE_EQ(frozenShadowing.findRaw<Logger>()->value, 4);
+    REQUIRE_EQ(rootContainer->findRaw<Logger>()->value, 1);
+    REQUIRE_EQ(frozenShadowing.find<Service>().get(), baseContainer->findRaw<Service>());
+}
+
+TEST_CASE("should keep every interface of frozen Container within a flat array") {
+    auto rootContainer = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto baseContainer = liant::makeContainer(rootContainer, liant::registerInstanceOf<Config>());
+    auto container = liant::makeContainer(baseContainer, liant::registerInstanceOf<Service>());
+
+    using Frozen = decltype(container->freeze());
+    // note: one pointer per interface (the whole base containers chain included) plus the reference to the Container
+    static_assert(sizeof(Frozen) == 4 * sizeof(void*));
+
+    // note: read-only, nothing can be created or destroyed through the frozen Container
+    static_assert(!MutableContainer<Frozen>);
+    static_assert(MutableContainer<decltype(container)::element_type>);
+
+    const Frozen frozen = container->freeze();
+    REQUIRE_EQ(frozen.findRaw<Service>(), container->findRaw<Service>());
+    REQUIRE_EQ(frozen.findRaw<Config>(), baseContainer->findRaw<Config>());
+    REQUIRE_EQ(frozen.findRaw<Logger>(), rootContainer->findRaw<Logger>());
+}
+
+TEST_CASE("should find items of frozen Container from many threads") {
+    auto baseContainer = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto container = liant::makeContainer(baseContainer, liant::registerInstanceOf<Config>(), liant::registerInstanceOf<Service>());
+    const auto frozen = container->freeze();
+
+    std::atomic<int> sum{};
+    {
+        ThreadPool pool(4);
+        for (int i = 0; i < 4; ++i) {
+            pool([&] {
+                for (int j = 0; j < 1000; ++j) {
+                    sum += frozen.findRaw<Logger>()->value + frozen.findRaw<Config>()->value + frozen.resolveRaw<Service>().value;
+                }
+            });
+        }
+    }
+    REQUIRE_EQ(sum.load(), 4 * 1000 * 6);
+}
+
+TEST_CASE("should keep Container alive while its frozen snapshot exists") {
+    Stats stats;
+
+    auto container = liant::makeContainer(liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)));
+    auto frozen = container->freeze();
+    REQUIRE_EQ(stats.creationOrder, "Trackable1 ");
+    REQUIRE_EQ(container.use_count(), 1);
+    REQUIRE_EQ(container->useCount(), 2);
+
+    Trackable<1>* trackable = container->findRaw<Trackable<1>>();
+    container.reset();
+    REQUIRE(stats.destroyingOrder.empty());
+    REQUIRE_EQ(frozen.findRaw<Trackable<1>>(), trackable);
+    REQUIRE_EQ(frozen.find<Trackable<1>>().get(), trackable);
+
+    {
+        auto tmp = std::move(frozen);
+    }
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+}
+} // namespace liant::test
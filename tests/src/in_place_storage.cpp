@@ -0,0 +1,112 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <doctest/doctest.h>
+
+namespace liant::test {
+using namespace linked;
+
+namespace {
+template <typename TContainer, typename T>
+bool livesInside(const std::shared_ptr<TContainer>& container, const T* item) {
+    const auto* begin = reinterpret_cast<const std::byte*>(container.get());
+    const auto* end = begin + sizeof(TContainer);
+    const auto* address = reinterpret_cast<const std::byte*>(item);
+
+    return begin <= address && address < end;
+}
+
+template <auto IdV>
+struct Counted {
+    Counted(int& alive)
+        : alive(alive) {
+        ++alive;
+    }
+    ~Counted() {
+        --alive;
+    }
+    int& alive;
+};
+} // namespace
+
+TEST_CASE("should store in-place items inside the container object") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<TrivialDerived<1>>().as<Interface<1>>().inPlace(),
+        liant::registerInstanceOf<NonTrivial<2>>().inPlace().bindArgs(22),
+        liant::registerInstanceOf<Trivial<3>>()
+    );
+    // clang-format on
+    container->resolveAll();
+
+    REQUIRE(container->find<Interface<1>>());
+    REQUIRE(container->find<NonTrivial<2>>());
+    REQUIRE(container->find<Trivial<3>>());
+
+    REQUIRE_EQ(container->find<Interface<1>>()->getId(), 1);
+    REQUIRE_EQ(container->find<NonTrivial<2>>()->Id, 22);
+    REQUIRE_EQ(container->find<Trivial<3>>()->Id, 3);
+
+    REQUIRE(livesInside(container, container->findRaw<Interface<1>>()));
+    REQUIRE(livesInside(container, container->findRaw<NonTrivial<2>>()));
+    REQUIRE_FALSE(livesInside(container, container->findRaw<Trivial<3>>()));
+}
+
+TEST_CASE("should resolve dependencies of in-place items") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<TrivialType1>().inPlace(),
+        liant::registerInstanceOf<TrivialType2>(),
+        liant::registerInstanceOf<DerivedType1>().as<Interface1>().inPlace(),
+        liant::registerInstanceOf<DerivedType2>().as<Interface2>().inPlace()
+    );
+    // clang-format on
+    container->resolve<Interface2>();
+
+    REQUIRE(container->find<TrivialType1>());
+    REQUIRE(container->find<TrivialType2>());
+    REQUIRE(container->find<Interface1>());
+    REQUIRE(container->find<Interface2>());
+
+    REQUIRE(livesInside(container, container->findRaw<Interface2>()));
+}
+
+TEST_CASE("should call postCreate/preDestroy and destructors of in-place items in the usual order") {
+    Stats stats;
+    int alive = 0;
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Trackable<1>>().inPlace().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Trackable<2>>().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Trackable<3>>().inPlace().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Counted<1>>().inPlace().bindArgs(std::ref(alive)),
+            liant::registerInstanceOf<Counted<2>>().inPlace().bindArgs(std::ref(alive))
+        );
+        // clang-format on
+        container->resolveAll();
+
+        REQUIRE_EQ(stats.creationOrder, "Trackable1 Trackable2 Trackable3 ");
+        REQUIRE_EQ(alive, 2);
+    }
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable3 Trackable2 Trackable1 ");
+    REQUIRE_EQ(alive, 0);
+}
+
+TEST_CASE("should not construct in-place items which were never resolved") {
+    int alive = 0;
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Counted<1>>().inPlace().bindArgs(std::ref(alive)),
+            liant::registerInstanceOf<Counted<2>>().inPlace().bindArgs(std::ref(alive))
+        );
+        // clang-format on
+        container->resolve<Counted<2>>();
+
+        REQUIRE_FALSE(container->find<Counted<1>>());
+        REQUIRE(container->find<Counted<2>>());
+        REQUIRE_EQ(alive, 1);
+    }
+    REQUIRE_EQ(alive, 0);
+}
+} // namespace liant::test
@@ -0,0 +1,183 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include "thread_pool.hpp"
+#include <atomic>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace liant::test {
+
+namespace ownership {
+struct Logger {
+    int value = 42;
+};
+
+struct Service {
+    Service(liant::ContainerSliceWeak<Logger> di)
+        : di(di) {}
+
+    liant::ContainerSliceWeak<Logger> di;
+};
+
+struct Client {
+    liant::ContainerSliceWeak<Service> di;
+};
+} // namespace ownership
+using namespace ownership;
+
+// two pointers: the 'Dependency' and the 'Container' (or its reference counts)
+static_assert(sizeof(SharedRef<Logger>) == 2 * sizeof(void*));
+static_assert(sizeof(SharedPtr<Logger>) == 2 * sizeof(void*));
+static_assert(sizeof(WeakPtr<Logger>) == 2 * sizeof(void*));
+
+TEST_CASE("should report the ownership policy of Container") {
+    auto atomic = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto sharded = liant::makeContainer(liant::OwnershipPolicy::Sharded, liant::registerInstanceOf<Logger>());
+    auto nonAtomic = liant::makeContainer(liant::OwnershipPolicy::NonAtomic, liant::registerInstanceOf<Logger>());
+
+    REQUIRE_EQ(atomic->getOwnershipPolicy(), liant::OwnershipPolicy::Atomic);
+    REQUIRE_EQ(sharded->getOwnershipPolicy(), liant::OwnershipPolicy::Sharded);
+    REQUIRE_EQ(nonAtomic->getOwnershipPolicy(), liant::OwnershipPolicy::NonAtomic);
+}
+
+TEST_CASE("should keep Container with non-Atomic ownership policy alive while SharedRef/SharedPtr exist") {
+    for (auto policy : { liant::OwnershipPolicy::Sharded, liant::OwnershipPolicy::NonAtomic }) {
+        Stats stats;
+
+        // clang-format off
+        auto container = liant::makeContainer(policy,
+            liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Trackable<2>>().bindArgs(std::ref(stats))
+        );
+        // clang-format on
+        container->resolveAll();
+
+        WeakPtr<Trackable<2>> weakPtr = container->find<Trackable<2>>();
+        {
+            SharedRef<Trackable<1>> sharedRef = container->resolve<Trackable<1>>();
+            SharedPtr<Trackable<2>> sharedPtr = container->find<Trackable<2>>();
+
+            container.reset();
+            REQUIRE_EQ(stats.destroyingOrder, "");
+            REQUIRE(weakPtr);
+
+            sharedPtr.reset();
+            REQUIRE_EQ(stats.destroyingOrder, "");
+            REQUIRE(weakPtr);
+            REQUIRE(weakPtr.lock());
+        }
+        // note: the last owner is gone
+        REQUIRE_EQ(stats.destroyingOrder, "Trackable2 Trackable1 ");
+        REQUIRE_FALSE(weakPtr);
+        REQUIRE_FALSE(weakPtr.lock());
+    }
+}
+
+TEST_CASE("should keep Container with non-Atomic ownership policy alive while slices exist") {
+    for (auto policy : { liant::OwnershipPolicy::Sharded, liant::OwnershipPolicy::NonAtomic }) {
+        // clang-format off
+        auto container = liant::makeContainer(policy,
+            liant::registerInstanceOf<Logger>(),
+            liant::registerInstanceOf<Service>(),
+            liant::registerInstanceOf<Client>()
+        );
+        // clang-format on
+        std::weak_ptr<void> weakContainer = container;
+        liant::ContainerSliceLazy<Client> clientSlice(container);
+
+        liant::ContainerSlice<Logger, Service> slice(container);
+        liant::ContainerSliceWeak<Service> sliceWeak(slice);
+        // 'std::shared_ptr' returned by 'makeContainer' is counted as a single reference (+ 2 slices)
+        REQUIRE_EQ(slice.useCount(), 3);
+
+        container.reset();
+        // note: 'std::shared_ptr' copies are gone but the 'Container' itself is still alive
+        REQUIRE(weakContainer.expired());
+        REQUIRE_EQ(slice.useCount(), 2);
+
+        liant::ContainerSlice<Service> service = sliceWeak.lock();
+        REQUIRE_EQ(service.resolve<Service>()->di.lock().findRaw<Logger>()->value, 42);
+        REQUIRE_EQ(slice.useCount(), 3);
+
+        // 'Client::di' is injected with no 'std::shared_ptr' to the 'Container' around
+        Client& client = clientSlice.resolveRaw<Client>();
+        REQUIRE_EQ(client.di.lock().findRaw<Service>(), service.findRaw<Service>());
+        REQUIRE_EQ(slice.useCount(), 3);
+    }
+}
+
+TEST_CASE("should convert SharedRef/SharedPtr into std::shared_ptr sharing the ownership of Container") {
+    for (auto policy : { liant::OwnershipPolicy::Atomic, liant::OwnershipPolicy::Sharded, liant::OwnershipPolicy::NonAtomic }) {
+        Stats stats;
+        auto container = liant::makeContainer(policy, liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)));
+        WeakPtr<Trackable<1>> weakPtr = container->resolve<Trackable<1>>();
+
+        std::shared_ptr<Trackable<1>> owning;
+        {
+            SharedPtr<Trackable<1>> sharedPtr = container->find<Trackable<1>>();
+
+            // note: aliases the 'std::shared_ptr' returned by 'makeContainer' (same control block, nothing is allocated)
+            std::shared_ptr<Trackable<1>> aliased = sharedPtr.toStdShared();
+            REQUIRE_EQ(aliased.get(), sharedPtr.get());
+            REQUIRE_FALSE(aliased.owner_before(container));
+            REQUIRE_FALSE(container.owner_before(aliased));
+            REQUIRE_EQ(container->useCount(), 2);
+
+            container.reset();
+            aliased.reset();
+            REQUIRE(weakPtr);
+
+            // note: no 'std::shared_ptr' returned by 'makeContainer' is around anymore
+            owning = sharedPtr.toSharedRef().toStdShared();
+            REQUIRE_EQ(owning.get(), sharedPtr.get());
+        }
+        REQUIRE(weakPtr);
+        REQUIRE_EQ(stats.destroyingOrder, "");
+
+        owning.reset();
+        REQUIRE_FALSE(weakPtr);
+        REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+    }
+}
+
+TEST_CASE("should count Container owners copied on many threads with Sharded ownership policy") {
+    constexpr std::size_t TasksCount = 64;
+    constexpr std::size_t CopiesCount = 1'000;
+
+    Stats stats;
+    auto container = liant::makeContainer(
+        liant::OwnershipPolicy::Sharded, liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)));
+    SharedPtr<Trackable<1>> root = container->resolve<Trackable<1>>();
+    WeakPtr<Trackable<1>> weakPtr = root;
+
+    std::atomic<std::size_t> copied{};
+    std::atomic<std::size_t> finished{};
+    {
+        ThreadPool pool(8);
+        for (std::size_t i = 0; i < TasksCount; ++i) {
+            // every owner is released on some other thread (owners may be acquired and released on different threads)
+            pool([&pool, &copied, &finished, owner = root] {
+                for (std::size_t j = 0; j < CopiesCount; ++j) {
+                    SharedPtr<Trackable<1>> copy = owner;
+                    copied.fetch_add(copy ? 1 : 0, std::memory_order_relaxed);
+                }
+                pool([&finished, owner] { finished.fetch_add(1); });
+            });
+        }
+        container.reset();
+        while (finished.load() != TasksCount) {
+            std::this_thread::yield();
+        }
+    }
+    REQUIRE_EQ(copied.load(), TasksCount * CopiesCount);
+    REQUIRE_EQ(stats.destroyingOrder, "");
+    REQUIRE(weakPtr);
+
+    root.reset();
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable1 ");
+    REQUIRE_FALSE(weakPtr);
+}
+} // namespace liant::test
@@ -0,0 +1,302 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include "thread_pool.hpp"
+#include <doctest/doctest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace liant::test {
+
+namespace {
+// thread safe version of 'Stats'
+struct SharedStats {
+    void created(const std::string& name) {
+        std::lock_guard lock(mutex);
+        stats.creationOrder += name + " ";
+    }
+    void destroyed(const std::string& name) {
+        std::lock_guard lock(mutex);
+        stats.destroyingOrder += name + " ";
+    }
+
+    std::mutex mutex;
+    Stats stats;
+};
+
+// every 'Meeting' participant waits (for a limited time) until all the participants show up
+struct Meeting {
+    bool join(int participants) {
+        std::unique_lock lock(mutex);
+        ++arrived;
+        cv.notify_all();
+        return cv.wait_for(lock, std::chrono::seconds(5), [&] { return arrived >= participants; });
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int arrived{};
+};
+
+template <auto IdV>
+struct Leaf {
+    Leaf(SharedStats& stats, Meeting& meeting)
+        : stats(stats)
+        , metOthers(meeting.join(2)) {}
+
+    void postCreate() {
+        stats.created("Leaf" + std::to_string(IdV));
+    }
+    void preDestroy() {
+        stats.destroyed("Leaf" + std::to_string(IdV));
+    }
+
+    SharedStats& stats;
+    bool metOthers{};
+};
+
+struct Root {
+    Root(liant::ContainerView<Leaf<1>, Leaf<2>> di, SharedStats& stats)
+        : di(di)
+        , stats(stats) {}
+
+    void postCreate() {
+        stats.created("Root");
+    }
+    void preDestroy() {
+        stats.destroyed("Root");
+    }
+
+    liant::ContainerView<Leaf<1>, Leaf<2>> di;
+    SharedStats& stats;
+};
+
+struct Counted {
+    Counted(std::atomic<int>& created) {
+        ++created;
+    }
+};
+
+struct Shared {
+    Shared(liant::ContainerView<Counted>) {}
+};
+
+template <auto IdV>
+struct User {
+    User(liant::ContainerView<Shared>) {}
+};
+
+struct Throwing {
+    Throwing(int& attempts) {
+        if (++attempts == 1) {
+            throw std::runtime_error("Throwing");
+        }
+    }
+};
+
+struct ThrowingOnce {
+    ThrowingOnce(std::string name, int& attempts)
+        : name(std::move(name)) {
+        if (++attempts == 1) {
+            throw std::runtime_error("ThrowingOnce");
+        }
+    }
+
+    std::string name;
+};
+
+struct ThrowingOnPostCreate {
+    ThrowingOnPostCreate(int& alive, int& attempts)
+        : alive(alive)
+        , attempts(attempts) {
+        ++alive;
+    }
+    ~ThrowingOnPostCreate() {
+        --alive;
+    }
+
+    void postCreate() {
+        if (++attempts == 1) {
+            throw std::runtime_error("ThrowingOnPostCreate");
+        }
+    }
+
+    int& alive;
+    int& attempts;
+};
+} // namespace
+
+TEST_CASE("should create independent items simultaneously while respecting the dependencies order") {
+    SharedStats stats;
+    Meeting meeting;
+    ThreadPool pool(3);
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Root>().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Leaf<1>>().bindArgs(std::ref(stats), std::ref(meeting)),
+            liant::registerInstanceOf<Leaf<2>>().bindArgs(std::ref(stats), std::ref(meeting))
+        );
+        // clang-format on
+        container->resolveAllParallel(pool);
+
+        // both leafs were being created at the same time
+        REQUIRE(container->findRaw<Leaf<1>>()->metOthers);
+        REQUIRE(container->findRaw<Leaf<2>>()->metOthers);
+        REQUIRE(container->find<Root>());
+
+        const bool leafsFirst = stats.stats.creationOrder == "Leaf1 Leaf2 Root " ||
+            stats.stats.creationOrder == "Leaf2 Leaf1 Root ";
+        REQUIRE(leafsFirst);
+    }
+    // destroyed in the order opposite to the actual creation order
+    const bool rootFirst =
+        (stats.stats.creationOrder == "Leaf1 Leaf2 Root " && stats.stats.destroyingOrder == "Root Leaf2 Leaf1 ") ||
+        (stats.stats.creationOrder == "Leaf2 Leaf1 Root " && stats.stats.destroyingOrder == "Root Leaf1 Leaf2 ");
+    REQUIRE(rootFirst);
+}
+
+TEST_CASE("should create an item shared by simultaneously created items exactly once") {
+    std::atomic<int> created = 0;
+    ThreadPool pool(4);
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Counted>().bindArgs(std::ref(created)),
+        liant::registerInstanceOf<Shared>(),
+        liant::registerInstanceOf<User<1>>(),
+        liant::registerInstanceOf<User<2>>(),
+        liant::registerInstanceOf<User<3>>(),
+        liant::registerInstanceOf<User<4>>()
+    );
+    // clang-format on
+    container->resolveAllParallel(pool);
+
+    REQUIRE_EQ(created.load(), 1);
+    REQUIRE(container->find<Shared>());
+    REQUIRE(container->find<User<1>>());
+    REQUIRE(container->find<User<2>>());
+    REQUIRE(container->find<User<3>>());
+    REQUIRE(container->find<User<4>>());
+}
+
+TEST_CASE("should resolve base container in parallel as well") {
+    std::atomic<int> created = 0;
+    ThreadPool pool(2);
+
+    // clang-format off
+    auto baseContainer = liant::makeContainer(
+        liant::registerInstanceOf<Counted>().bindArgs(std::ref(created)),
+        liant::registerInstanceOf<Shared>()
+    );
+    auto container = liant::makeContainer(
+        liant::baseContainer(baseContainer),
+        liant::registerInstanceOf<User<1>>(),
+        liant::registerInstanceOf<User<2>>()
+    );
+    // clang-format on
+    container->resolveAllParallel(pool);
+
+    REQUIRE_EQ(created.load(), 1);
+    REQUIRE(baseContainer->find<Shared>());
+    REQUIRE(container->find<User<1>>());
+    REQUIRE(container->find<User<2>>());
+}
+
+TEST_CASE("should rethrow the exception thrown while creating an item in parallel and allow to retry") {
+    int attempts = 0;
+    std::atomic<int> created = 0;
+    ThreadPool pool(2);
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Throwing>().bindArgs(std::ref(attempts)),
+        liant::registerInstanceOf<Counted>().bindArgs(std::ref(created))
+    );
+    // clang-format on
+
+    bool thrown = false;
+    try {
+        container->resolveAllParallel(pool);
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+    REQUIRE_FALSE(container->find<Throwing>());
+    REQUIRE(container->find<Counted>());
+
+    container->resolveAllParallel(pool);
+    REQUIRE(container->find<Throwing>());
+    REQUIRE_EQ(attempts, 2);
+    REQUIRE_EQ(created.load(), 1);
+}
+
+TEST_CASE("should pass the same binded args to the item being resolved again after it has failed") {
+    int attempts = 0;
+    const std::string name = "long enough not to fit into the small string buffer";
+
+    auto container = liant::makeContainer(liant::registerInstanceOf<ThrowingOnce>().bindArgs(name, std::ref(attempts)));
+
+    bool thrown = false;
+    try {
+        container->resolveAllParallel(liant::InlineExecutor{});
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+
+    REQUIRE_EQ(container->resolveRaw<ThrowingOnce>().name, name);
+    REQUIRE_EQ(attempts, 2);
+}
+
+template <typename TRegisteredItem>
+void requireRetriedAfterFailedPostCreate(TRegisteredItem item) {
+    int alive = 0;
+    int attempts = 0;
+    {
+        auto container = liant::makeContainer(std::move(item).bindArgs(std::ref(alive), std::ref(attempts)));
+
+        bool thrown = false;
+        try {
+            container->resolveAllParallel(liant::InlineExecutor{});
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        REQUIRE(thrown);
+        REQUIRE_FALSE(container->template findRaw<ThrowingOnPostCreate>());
+        REQUIRE_EQ(alive, 0);
+
+        container->template resolveRaw<ThrowingOnPostCreate>();
+        REQUIRE_EQ(alive, 1);
+        REQUIRE_EQ(attempts, 2);
+    }
+    REQUIRE_EQ(alive, 0);
+}
+
+TEST_CASE("should destroy the item whose postCreate has thrown and allow to retry") {
+    requireRetriedAfterFailedPostCreate(liant::registerInstanceOf<ThrowingOnPostCreate>());
+    requireRetriedAfterFailedPostCreate(liant::registerInstanceOf<ThrowingOnPostCreate>().inPlace());
+}
+
+TEST_CASE("should resolve all items on the calling thread using InlineExecutor") {
+    SharedStats stats;
+    Meeting meeting;
+    // nobody else is coming to the meeting
+    meeting.arrived = 1;
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Root>().bindArgs(std::ref(stats)),
+        liant::registerInstanceOf<Leaf<1>>().bindArgs(std::ref(stats), std::ref(meeting)),
+        liant::registerInstanceOf<Leaf<2>>().bindArgs(std::ref(stats), std::ref(meeting))
+    );
+    // clang-format on
+    container->resolveAllParallel(liant::InlineExecutor{});
+
+    REQUIRE_EQ(stats.stats.creationOrder, "Leaf1 Leaf2 Root ");
+}
+} // namespace liant::test
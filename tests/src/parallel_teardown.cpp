@@ -0,0 +1,269 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include "thread_pool.hpp"
+#include <doctest/doctest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace liant::test {
+
+namespace {
+struct SharedStats {
+    void destroyed(const std::string& name) {
+        std::lock_guard lock(mutex);
+        stats.destroyingOrder += name + " ";
+    }
+
+    std::mutex mutex;
+    Stats stats;
+};
+
+// every 'Meeting' participant waits (for a limited time) until all the participants show up
+struct Meeting {
+    bool join(int participants) {
+        std::unique_lock lock(mutex);
+        ++arrived;
+        cv.notify_all();
+        return cv.wait_for(lock, std::chrono::seconds(5), [&] { return arrived >= participants; });
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    int arrived{};
+};
+
+template <auto IdV>
+struct Leaf {
+    Leaf(SharedStats& stats, Meeting& meeting)
+        : stats(stats)
+        , meeting(meeting) {}
+
+    void preDestroy() {
+        meeting.join(2);
+        stats.destroyed("Leaf" + std::to_string(IdV));
+    }
+
+    SharedStats& stats;
+    Meeting& meeting;
+};
+
+struct Root {
+    Root(liant::ContainerView<Leaf<1>, Leaf<2>> di, SharedStats& stats)
+        : di(di)
+        , stats(stats) {}
+
+    void preDestroy() {
+        stats.destroyed("Root");
+    }
+
+    liant::ContainerView<Leaf<1>, Leaf<2>> di;
+    SharedStats& stats;
+};
+
+template <auto IdV>
+struct Tracked {
+    Tracked(SharedStats& stats)
+        : stats(stats) {}
+
+    void preDestroy() {
+        stats.destroyed("Tracked" + std::to_string(IdV));
+    }
+
+    SharedStats& stats;
+};
+
+struct LazyHolder {
+    LazyHolder(liant::ContainerViewLazy<Tracked<2>> di, SharedStats& stats)
+        : di(di)
+        , stats(stats) {}
+
+    void preDestroy() {
+        stats.destroyed("LazyHolder");
+    }
+
+    liant::ContainerViewLazy<Tracked<2>> di;
+    SharedStats& stats;
+};
+
+struct Slow {
+    void preDestroy() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+};
+
+struct ThrowingOnDestroy {
+    ThrowingOnDestroy(int& alive)
+        : alive(alive) {
+        ++alive;
+    }
+    ~ThrowingOnDestroy() {
+        --alive;
+    }
+    void preDestroy() {
+        throw std::runtime_error("ThrowingOnDestroy");
+    }
+    int& alive;
+};
+
+struct Alive {
+    Alive(int& alive)
+        : alive(alive) {
+        ++alive;
+    }
+    ~Alive() {
+        --alive;
+    }
+    int& alive;
+};
+} // namespace
+
+TEST_CASE("should destroy independent items simultaneously after the items depending on them") {
+    SharedStats stats;
+    Meeting meeting;
+    ThreadPool pool(2);
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Root>().bindArgs(std::ref(stats)),
+        liant::registerInstanceOf<Leaf<1>>().bindArgs(std::ref(stats), std::ref(meeting)),
+        liant::registerInstanceOf<Leaf<2>>().bindArgs(std::ref(stats), std::ref(meeting))
+    );
+    // clang-format on
+    container->resolveAll();
+
+    liant::TeardownReport report = container->destroyAllParallel(pool, std::chrono::seconds(5));
+
+    // both leafs were being destroyed at the same time (otherwise the first one would have waited for the second one in vain)
+    REQUIRE_EQ(meeting.arrived, 2);
+    REQUIRE(report.elapsed < std::chrono::seconds(5));
+    REQUIRE(report.withinDeadline());
+    REQUIRE_EQ(report.wavesCount, 2);
+
+    const bool rootFirst =
+        stats.stats.destroyingOrder == "Root Leaf1 Leaf2 " || stats.stats.destroyingOrder == "Root Leaf2 Leaf1 ";
+    REQUIRE(rootFirst);
+
+    REQUIRE_FALSE(container->find<Root>());
+    REQUIRE_FALSE(container->find<Leaf<1>>());
+    REQUIRE_FALSE(container->find<Leaf<2>>());
+}
+
+TEST_CASE("should destroy item with lazy dependencies before the items created earlier") {
+    SharedStats stats;
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Tracked<1>>().bindArgs(std::ref(stats)),
+        liant::registerInstanceOf<LazyHolder>().bindArgs(std::ref(stats)),
+        liant::registerInstanceOf<Tracked<2>>().bindArgs(std::ref(stats))
+    );
+    // clang-format on
+    container->resolve<Tracked<1>>();
+    container->resolve<LazyHolder>();
+    container->resolve<Tracked<2>>();
+
+    liant::TeardownReport report = container->destroyAllParallel(liant::InlineExecutor{}, std::chrono::seconds(5));
+
+    // 'LazyHolder' might use 'Tracked<1>' as well as 'Tracked<2>' so it goes first, the rest are independent
+    REQUIRE_EQ(report.wavesCount, 2);
+    const bool holderFirst = stats.stats.destroyingOrder == "LazyHolder Tracked2 Tracked1 " ||
+        stats.stats.destroyingOrder == "LazyHolder Tracked1 Tracked2 ";
+    REQUIRE(holderFirst);
+}
+
+TEST_CASE("should report items which were destroyed after the deadline") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Slow>(),
+        liant::registerInstanceOf<Trivial<1>>()
+    );
+    // clang-format on
+    container->resolveAll();
+
+    liant::TeardownReport report = container->destroyAllParallel(liant::InlineExecutor{}, std::chrono::milliseconds(1));
+
+    REQUIRE_FALSE(report.withinDeadline());
+    REQUIRE_EQ(report.overruns.size(), 1);
+    REQUIRE(report.overruns[0].name.find("Slow") != std::string_view::npos);
+    REQUIRE(report.overruns[0].duration >= std::chrono::milliseconds(50));
+    REQUIRE(report.elapsed >= std::chrono::milliseconds(50));
+}
+
+TEST_CASE("should destroy all items and then rethrow the exception thrown by preDestroy") {
+    int alive = 0;
+    ThreadPool pool(2);
+
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<ThrowingOnDestroy>().bindArgs(std::ref(alive)),
+        liant::registerInstanceOf<Alive>().bindArgs(std::ref(alive))
+    );
+    // clang-format on
+    container->resolveAll();
+    REQUIRE_EQ(alive, 2);
+
+    bool thrown = false;
+    try {
+        container->destroyAllParallel(pool, std::chrono::seconds(5));
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    REQUIRE(thrown);
+    REQUIRE_EQ(alive, 0);
+}
+
+TEST_CASE("should destroy the items on the calling thread once the executor rejects their tasks") {
+    int alive = 0;
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Alive>().bindArgs(std::ref(alive)),
+            liant::registerInstanceOf<Trivial<1>>(),
+            liant::registerInstanceOf<Trivial<2>>()
+        );
+        // clang-format on
+        container->resolveAll();
+
+        // note: runs the first task only
+        int accepted = 1;
+        auto executor = [&accepted](auto task) {
+            if (accepted-- <= 0) {
+                throw std::runtime_error("rejected");
+            }
+            task();
+        };
+
+        bool thrown = false;
+        try {
+            container->destroyAllParallel(executor, std::chrono::seconds(5));
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        REQUIRE(thrown);
+        REQUIRE_EQ(alive, 0);
+        REQUIRE_FALSE(container->findRaw<Alive>());
+        REQUIRE_FALSE(container->findRaw<Trivial<1>>());
+        REQUIRE_FALSE(container->findRaw<Trivial<2>>());
+    }
+    REQUIRE_EQ(alive, 0);
+}
+
+TEST_CASE("should not destroy items twice once the container itself is destroyed") {
+    int alive = 0;
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Alive>().bindArgs(std::ref(alive))
+        );
+        // clang-format on
+        container->resolveAll();
+        container->destroyAllParallel(liant::InlineExecutor{}, std::chrono::seconds(5));
+        REQUIRE_EQ(alive, 0);
+    }
+    REQUIRE_EQ(alive, 0);
+}
+} // namespace liant::test
@@ -0,0 +1,158 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <array>
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <functional>
+#include <memory_resource>
+#include <utility>
+
+namespace liant::test {
+
+namespace scoped {
+struct Logger {
+    int value = 1;
+};
+
+struct Config {
+    int value = 2;
+};
+
+struct RequestContext {
+    int id = 0;
+};
+
+struct Handler {
+    Handler(liant::ContainerView<Logger, Config, RequestContext> di)
+        : di(di) {}
+
+    int handle() {
+        return di.resolveRaw<Logger>().value + di.resolveRaw<Config>().value + di.resolveRaw<RequestContext>().id;
+    }
+
+    liant::ContainerView<Logger, Config, RequestContext> di;
+};
+
+// arena over the buffer only: running out of it is an error
+struct Arena {
+    alignas(std::max_align_t) std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource resource{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+    bool owns(const void* ptr) const {
+        return ptr >= buffer.data() && ptr < buffer.data() + buffer.size();
+    }
+};
+} // namespace scoped
+using namespace scoped;
+
+TEST_CASE("should make scoped Container and its items within the arena") {
+    Arena arena;
+    auto scope = liant::makeScopedContainer(arena.resource, liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+
+    REQUIRE(arena.owns(scope.get()));
+    REQUIRE(arena.owns(&scope->resolveRaw<Logger>()));
+    REQUIRE(arena.owns(&scope->resolveRaw<Config>()));
+    REQUIRE_EQ(scope->findRaw<Config>()->value, 2);
+}
+
+TEST_CASE("should inherit items of the parent Container by pointer") {
+    auto parent = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    liant::ContainerView<Logger, Config> parentView(parent);
+    const long useCount = parent->useCount();
+
+    Arena arena;
+    {
+        auto scope = liant::makeScopedContainer(arena.resource, parentView, //
+            liant::registerInstanceOf<RequestContext>(), liant::registerInstanceOf<Handler>());
+        scope->resolveRaw<RequestContext>().id = 10;
+
+        REQUIRE_EQ(scope->findRaw<Logger>(), parent->findRaw<Logger>());
+        REQUIRE_EQ(&scope->resolveRaw<Config>(), parent->findRaw<Config>());
+        REQUIRE_EQ(scope->resolveRaw<Handler>().handle(), 13);
+        REQUIRE(arena.owns(scope->findRaw<Handler>()));
+        // note: the view doesn't count references
+        REQUIRE_EQ(parent->useCount(), useCount);
+    }
+    REQUIRE_EQ(parent->findRaw<Logger>()->value, 1);
+}
+
+TEST_CASE("should keep the parent Container of scoped Container made with ContainerSlice alive") {
+    Arena arena;
+    auto parent = liant::makeContainer(liant::registerInstanceOf<Logger>());
+    auto scope = liant::makeScopedContainer(arena.resource, liant::ContainerSlice<Logger>(parent), liant::registerInstanceOf<Config>());
+
+    Logger* logger = parent->findRaw<Logger>();
+    parent.reset();
+    REQUIRE_EQ(scope->findRaw<Logger>(), logger);
+    REQUIRE_EQ(scope->resolveRaw<Logger>().value, 1);
+}
+
+TEST_CASE("should destroy scoped Container items in the reverse creation order and leave the arena to the caller") {
+    Stats stats;
+    Arena arena;
+    {
+        // clang-format off
+        auto scope = liant::makeScopedContainer(arena.resource,
+            liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Trackable<2>>().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Trackable<3>>().bindArgs(std::ref(stats))
+        );
+        // clang-format on
+        scope->resolveRaw<Trackable<2>>();
+        scope->resolveRaw<Trackable<3>>();
+        scope->resolveRaw<Trackable<1>>();
+
+        // note: moved-from scope doesn't destroy anything
+        auto moved = std::move(scope);
+        REQUIRE_FALSE(scope);
+        REQUIRE(moved);
+        REQUIRE_EQ(stats.creationOrder, "Trackable2 Trackable3 Trackable1 ");
+        REQUIRE_EQ(stats.destroyingOrder, "");
+    }
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable1 Trackable3 Trackable2 ");
+
+    // note: the next scope reuses the arena from the start only once the caller has released it
+    {
+        auto scope = liant::makeScopedContainer(arena.resource, liant::registerInstanceOf<Logger>());
+        REQUIRE_NE(static_cast<void*>(scope.get()), static_cast<void*>(arena.buffer.data()));
+    }
+    arena.resource.release();
+    auto scope = liant::makeScopedContainer(arena.resource, liant::registerInstanceOf<Logger>());
+    REQUIRE_EQ(static_cast<void*>(scope.get()), static_cast<void*>(arena.buffer.data()));
+}
+
+TEST_CASE("should keep nested and sibling scoped Containers within the same arena apart") {
+    Arena arena;
+    auto outer = liant::makeScopedContainer(arena.resource, liant::registerInstanceOf<Config>());
+    Config& config = outer->resolveRaw<Config>();
+    {
+        auto inner = liant::makeScopedContainer(arena.resource, liant::registerInstanceOf<RequestContext>());
+        inner->resolveRaw<RequestContext>().id = 1;
+    }
+
+    auto sibling = liant::makeScopedContainer(arena.resource, liant::registerInstanceOf<RequestContext>());
+    sibling->resolveRaw<RequestContext>().id = 7;
+    REQUIRE_NE(static_cast<void*>(sibling.get()), static_cast<void*>(outer.get()));
+    REQUIRE_EQ(&outer->resolveRaw<Config>(), &config);
+    REQUIRE_EQ(config.value, 2);
+}
+
+TEST_CASE("should reuse the same arena for many scoped Containers") {
+    auto parent = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    liant::ContainerView<Logger, Config> parentView(parent);
+
+    // note: the arena would run out of the buffer (and throw) if it isn't released after every scope
+    Arena arena;
+    int sum = 0;
+    for (int i = 0; i < 10'000; ++i) {
+        {
+            auto scope = liant::makeScopedContainer(arena.resource, parentView, //
+                liant::registerInstanceOf<RequestContext>(), liant::registerInstanceOf<Handler>());
+            scope->resolveRaw<RequestContext>().id = i % 2;
+            sum += scope->resolveRaw<Handler>().handle();
+        }
+        arena.resource.release();
+    }
+    REQUIRE_EQ(sum, 10'000 * 3 + 5'000);
+}
+} // namespace liant::test
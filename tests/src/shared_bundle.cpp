@@ -0,0 +1,88 @@
+#include "liant/liant.hpp"
+#include <cstddef>
+#include <doctest/doctest.h>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace liant::test {
+
+namespace bundle {
+struct Logger {
+    std::size_t lines{};
+};
+
+struct Config {
+    std::string name = "config";
+};
+
+struct Database {
+    Database(liant::ContainerSliceWeak<Logger, Config> di)
+        : di(di) {}
+
+    liant::ContainerSliceWeak<Logger, Config> di;
+};
+} // namespace bundle
+using namespace bundle;
+
+static_assert(std::tuple_size_v<liant::SharedBundle<Logger, Config>> == 2);
+static_assert(std::is_same_v<std::tuple_element_t<1, liant::SharedBundle<Logger, Config>>, Config&>);
+
+TEST_CASE("should resolve several dependencies at once sharing a single reference to Container") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Logger>(),
+        liant::registerInstanceOf<Config>(),
+        liant::registerInstanceOf<Database>()
+    );
+    // clang-format on
+    REQUIRE_EQ(container->useCount(), 1);
+
+    auto [logger, config, database] = container->resolveMany<Logger, Config, Database>();
+    static_assert(std::is_same_v<decltype(logger), Logger&>);
+    REQUIRE_EQ(container->useCount(), 2);
+
+    REQUIRE_EQ(&logger, container->findRaw<Logger>());
+    REQUIRE_EQ(&config, container->findRaw<Config>());
+    REQUIRE_EQ(&database, container->findRaw<Database>());
+    REQUIRE_EQ(database.di.lock().findRaw<Config>()->name, "config");
+}
+
+TEST_CASE("should keep Container alive while SharedBundle exists") {
+    auto container = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+    liant::ContainerSliceWeakLazy<Logger> weakContainer(container);
+
+    auto bundle = container->resolveMany<Logger, Config>();
+    bundle.get<Logger>().lines = 3;
+    liant::SharedRef<Config> config = bundle.toSharedRef<Config>();
+    container.reset();
+    REQUIRE(weakContainer.lock());
+
+    REQUIRE_EQ(bundle.get<0>().lines, 3);
+    {
+        auto moved = std::move(bundle);
+        REQUIRE_EQ(moved.get<1>().name, "config");
+    }
+    // note: 'SharedRef' taken from the bundle still holds the 'Container'
+    REQUIRE(weakContainer.lock());
+    REQUIRE_EQ(config->name, "config");
+}
+
+TEST_CASE("should resolve several dependencies at once from slices") {
+    auto container = liant::makeContainer(liant::registerInstanceOf<Logger>(), liant::registerInstanceOf<Config>());
+
+    liant::ContainerSliceLazy<Logger, Config> slice(container);
+    REQUIRE_FALSE(container->findRaw<Logger>());
+    {
+        auto [config, logger] = slice.resolveMany<Config, Logger>();
+        REQUIRE_EQ(&logger, container->findRaw<Logger>());
+        REQUIRE_EQ(&config, container->findRaw<Config>());
+        REQUIRE_EQ(slice.useCount(), 3);
+    }
+    REQUIRE_EQ(slice.useCount(), 2);
+
+    liant::ContainerView<Logger, Config> view(container);
+    auto [logger] = view.resolveMany<Logger>();
+    REQUIRE_EQ(&logger, container->findRaw<Logger>());
+}
+} // namespace liant::test
@@ -151,4 +151,25 @@ TEST_CASE(
     REQUIRE(container->find<Interface<1>>()->getId() == 11);
     REQUIRE(container->find<Interface<2>>()->getId() == 22);
 }
-} // namespace liant::test
\ No newline at end of file
+
+TEST_CASE("should destroy only DI items in the order opposite to their actual creation order") {
+    Stats stats;
+    Trackable<3> external{ stats };
+    {
+        // clang-format off
+        auto container = liant::makeContainer(
+            liant::registerInstanceOf<Trackable<1>>().bindArgs(std::ref(stats)),
+            liant::registerInstanceOf<Trackable<2>>().bindArgs(std::ref(stats)),
+            liant::registerInstance(external),
+            liant::registerInstanceOf<Trackable<4>>().bindArgs(std::ref(stats))
+        );
+        // clang-format on
+        container->resolve<Trackable<4>>();
+        container->resolve<Trackable<1>>();
+        container->resolveAll();
+
+        REQUIRE_EQ(stats.creationOrder, "Trackable4 Trackable1 Trackable2 ");
+    }
+    REQUIRE_EQ(stats.destroyingOrder, "Trackable2 Trackable1 Trackable4 ");
+}
+} // namespace liant::test
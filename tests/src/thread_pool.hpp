@@ -0,0 +1,80 @@
+#pragma once
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace liant::test {
+
+// bare minimum executor for the tests: fixed number of threads & single shared queue
+class ThreadPool {
+public:
+    explicit ThreadPool(std::size_t threadsCount) {
+        for (std::size_t i = 0; i < threadsCount; ++i) {
+            threads.emplace_back([this] { work(); });
+        }
+    }
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex);
+            stopped = true;
+        }
+        wakeUp.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void operator()(std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        wakeUp.notify_one();
+    }
+
+    // 'co_await pool.schedule()' - continue the coroutine on one of the pool threads
+    auto schedule() {
+        struct Awaiter {
+            bool await_ready() const noexcept {
+                return false;
+            }
+            void await_suspend(std::coroutine_handle<> coro) {
+                pool([coro] { coro.resume(); });
+            }
+            void await_resume() const noexcept {}
+
+            ThreadPool& pool;
+        };
+        return Awaiter{ *this };
+    }
+
+private:
+    void work() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                wakeUp.wait(lock, [this] { return stopped || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> threads;
+    bool stopped{};
+};
+} // namespace liant::test
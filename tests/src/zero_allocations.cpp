@@ -0,0 +1,178 @@
+#include "data.hpp"
+#include "liant/liant.hpp"
+#include <doctest/doctest.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+namespace liant::test {
+// number of allocations made by the test executable so far (see 'allocations_count.cpp')
+std::size_t allocationsCount();
+
+namespace {
+// number of allocations made while running 'fn'
+template <typename TFn>
+std::size_t allocationsDuring(TFn fn) {
+    const std::size_t before = allocationsCount();
+    fn();
+    return allocationsCount() - before;
+}
+
+struct Z1 {
+    int i = 1;
+};
+struct Z2 {
+    int i = 2;
+};
+struct Z3 {
+    int i = 3;
+};
+
+struct Product {
+    liant::ContainerView<Z1, Z2> di;
+};
+
+struct ProductWithArgs {
+    liant::ContainerView<Z1, Z2> di;
+    int id;
+    const Z3& z3;
+};
+} // namespace
+
+TEST_CASE("should copy, move and convert views without allocations") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Z1>(),
+        liant::registerInstanceOf<Z2>(),
+        liant::registerInstanceOf<Z3>()
+    );
+    // clang-format on
+    liant::ContainerView<Z1, Z2, Z3> view(container);
+
+    const std::size_t allocations = allocationsDuring([&] {
+        liant::ContainerView<Z1, Z2, Z3> copy(view);
+        liant::ContainerView<Z1, Z2, Z3> moved(std::move(copy));
+        liant::ContainerView<Z3, Z1> subset(moved);
+        liant::ContainerViewLazy<Z1> lazySubset(subset);
+        liant::ContainerView<Z1> assigned(lazySubset);
+        assigned = subset;
+
+        auto lambda = [di = subset] { return di.findRaw<Z3>()->i; };
+        REQUIRE_EQ(lambda(), 3);
+        REQUIRE_EQ(assigned.findRaw<Z1>()->i, 1);
+    });
+    REQUIRE_EQ(allocations, 0);
+}
+
+TEST_CASE("should copy, move and convert slices without allocations") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Z1>(),
+        liant::registerInstanceOf<Z2>(),
+        liant::registerInstanceOf<Z3>()
+    );
+    // clang-format on
+    liant::ContainerSlice<Z1, Z2, Z3> slice(container);
+
+    const std::size_t allocations = allocationsDuring([&] {
+        liant::ContainerSlice<Z1, Z2, Z3> copy(slice);
+        liant::ContainerSlice<Z1, Z2, Z3> moved(std::move(copy));
+        liant::ContainerSliceLazy<Z2, Z1> subset(moved);
+        liant::ContainerView<Z2> view(subset);
+        liant::ContainerSliceWeak<Z1, Z2> weak(subset);
+        liant::ContainerSlice<Z1, Z2> locked = weak.lock();
+
+        REQUIRE_EQ(view.findRaw<Z2>()->i, 2);
+        REQUIRE_EQ(locked.findRaw<Z1>()->i, 1);
+    });
+    REQUIRE_EQ(allocations, 0);
+}
+
+TEST_CASE("should make, copy and use factories without allocations") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Z1>(),
+        liant::registerInstanceOf<Z2>(),
+        liant::registerInstanceOf<Z3>()
+    );
+    // clang-format on
+    liant::ContainerView<Z1, Z2, Z3> view(container);
+
+    const std::size_t allocations = allocationsDuring([&] {
+        liant::FactoryView<Product> factory = view.makeFactoryView<Product>();
+        liant::FactoryView<Product> copy = factory;
+        liant::Factory<Product> owningFactory = liant::ContainerSlice<Z1, Z2>(view).makeFactory<Product>();
+
+        Product product = copy.make();
+        Product otherProduct = owningFactory.make();
+        REQUIRE_EQ(product.di.findRaw<Z2>()->i, 2);
+        REQUIRE_EQ(otherProduct.di.findRaw<Z1>()->i, 1);
+    });
+    REQUIRE_EQ(allocations, 0);
+}
+
+TEST_CASE("should make pooled objects without allocations once the pool is warmed up") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Z1>(),
+        liant::registerInstanceOf<Z2>()
+    );
+    // clang-format on
+    liant::FactoryView<Product> factory = liant::ContainerView<Z1, Z2>(container).makeFactoryView<Product>();
+    factory.makePooled().reset();
+
+    const std::size_t allocations = allocationsDuring([&] {
+        for (int i = 0; i < 100; ++i) {
+            liant::Pooled<Product> product = factory.makePooled();
+            REQUIRE_EQ(product->di.findRaw<Z1>()->i, 1);
+        }
+    });
+    REQUIRE_EQ(allocations, 0);
+}
+
+TEST_CASE("should make objects with call-time arguments without allocations") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Z1>(),
+        liant::registerInstanceOf<Z2>()
+    );
+    // clang-format on
+    liant::ContainerView<Z1, Z2> view(container);
+    const Z3 z3;
+
+    const std::size_t allocations = allocationsDuring([&] {
+        liant::FactoryView<ProductWithArgs, int, const Z3&> factory = view.makeFactoryView<ProductWithArgs, int, const Z3&>();
+
+        ProductWithArgs product = factory.make(42, z3);
+        REQUIRE_EQ(product.id, 42);
+        REQUIRE_EQ(&product.z3, &z3);
+    });
+    REQUIRE_EQ(allocations, 0);
+}
+
+TEST_CASE("should make and destroy scoped Containers without allocations") {
+    // clang-format off
+    auto container = liant::makeContainer(
+        liant::registerInstanceOf<Z1>(),
+        liant::registerInstanceOf<Z2>()
+    );
+    // clang-format on
+    liant::ContainerView<Z1, Z2> view(container);
+    alignas(std::max_align_t) std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+
+    const std::size_t allocations = allocationsDuring([&] {
+        for (int i = 0; i < 100; ++i) {
+            {
+                auto scope = liant::makeScopedContainer(arena, view, liant::registerInstanceOf<Z3>(), liant::registerInstanceOf<Product>());
+                REQUIRE_EQ(scope->resolveRaw<Product>().di.findRaw<Z2>()->i, 2);
+                REQUIRE_EQ(scope->resolveRaw<Z3>().i, 3);
+            }
+            arena.release();
+        }
+    });
+    REQUIRE_EQ(allocations, 0);
+}
+} // namespace liant::test